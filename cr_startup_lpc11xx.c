@@ -588,6 +588,11 @@ extern unsigned int _bss;
 extern unsigned int _ebss;
 #endif
 
+//*****************************************************************************
+// Start of the free RAM below the stack, provided by the linker script.
+//*****************************************************************************
+extern unsigned int _pvHeapStart;
+
 
 //*****************************************************************************
 // Reset entry point for your code.
@@ -640,6 +645,18 @@ ResetISR(void) {
 	bss_init ((unsigned int)ExeAddr, SectionLen);
 #endif
 
+	// Paint the free RAM up to the current stack pointer so the
+	// application can find the stack high-water mark later on.
+	// The pattern has to match STACK_PAINT in main.cpp. Volatile so
+	// this never turns into a memset() call which would paint over
+	// its own stack frame.
+	volatile unsigned int *PaintAddr = &_pvHeapStart;
+	unsigned int *StackAddr;
+	__asm volatile ("mov %0, sp" : "=r" (StackAddr));
+	while (PaintAddr < StackAddr) {
+		*PaintAddr++ = 0xC5C5C5C5;
+	}
+
 	extern void SystemInit(void);
 	SystemInit();
 
@@ -1,686 +1,470 @@
-unsigned char duck_font_raw[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f,
-  0x5f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x03, 0x04, 0x07, 0x03, 0x00,
-  0x00, 0x14, 0x7f, 0x14, 0x7f, 0x7f, 0x14, 0x00, 0x00, 0x24, 0x2a, 0x7f,
-  0x7f, 0x2a, 0x12, 0x00, 0x00, 0x63, 0x33, 0x18, 0x0c, 0x66, 0x63, 0x00,
-  0x00, 0x3a, 0x7f, 0x4d, 0x7f, 0x32, 0x68, 0x00, 0x00, 0x00, 0x04, 0x07,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3e, 0x63, 0x41, 0x00, 0x00,
-  0x00, 0x00, 0x41, 0x63, 0x3e, 0x1c, 0x00, 0x00, 0x00, 0x2a, 0x3e, 0x1c,
-  0x1c, 0x3e, 0x2a, 0x00, 0x00, 0x08, 0x08, 0x3e, 0x3e, 0x08, 0x08, 0x00,
-  0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x80, 0xe0,
-  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x00, 0x00, 0x3e, 0x7f, 0x59,
-  0x4d, 0x7f, 0x3e, 0x00, 0x00, 0x44, 0x46, 0x7f, 0x7f, 0x40, 0x40, 0x00,
-  0x00, 0x46, 0x67, 0x71, 0x59, 0x4f, 0x46, 0x00, 0x00, 0x22, 0x63, 0x49,
-  0x49, 0x7f, 0x36, 0x00, 0x00, 0x38, 0x3c, 0x26, 0x7f, 0x7f, 0x20, 0x00,
-  0x00, 0x27, 0x67, 0x45, 0x45, 0x7d, 0x39, 0x00, 0x00, 0x3c, 0x7e, 0x4b,
-  0x49, 0x79, 0x30, 0x00, 0x00, 0x01, 0x01, 0x71, 0x79, 0x0f, 0x07, 0x00,
-  0x00, 0x36, 0x7f, 0x49, 0x49, 0x7f, 0x36, 0x00, 0x00, 0x06, 0x4f, 0x49,
-  0x69, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x6c, 0x00, 0x00, 0x00,
-  0x00, 0x40, 0x6c, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x36,
-  0x63, 0x41, 0x00, 0x00, 0x00, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x00,
-  0x00, 0x00, 0x41, 0x63, 0x36, 0x1c, 0x08, 0x00, 0x00, 0x06, 0x07, 0x51,
-  0x59, 0x0f, 0x06, 0x00, 0x1c, 0x22, 0x59, 0x55, 0x5d, 0x51, 0x1e, 0x00,
-  0x00, 0x7c, 0x7e, 0x13, 0x13, 0x7e, 0x7c, 0x00, 0x00, 0x7f, 0x7f, 0x49,
-  0x49, 0x7f, 0x36, 0x00, 0x00, 0x3e, 0x7f, 0x41, 0x41, 0x63, 0x22, 0x00,
-  0x00, 0x7f, 0x7f, 0x41, 0x63, 0x3e, 0x1c, 0x00, 0x00, 0x7f, 0x7f, 0x49,
-  0x49, 0x41, 0x41, 0x00, 0x00, 0x7f, 0x7f, 0x09, 0x09, 0x09, 0x01, 0x00,
-  0x00, 0x3e, 0x7f, 0x41, 0x51, 0x73, 0x32, 0x00, 0x00, 0x7f, 0x7f, 0x08,
-  0x08, 0x7f, 0x7f, 0x00, 0x00, 0x41, 0x41, 0x7f, 0x7f, 0x41, 0x41, 0x00,
-  0x00, 0x20, 0x61, 0x41, 0x7f, 0x3f, 0x01, 0x00, 0x00, 0x7f, 0x7f, 0x08,
-  0x1c, 0x77, 0x63, 0x00, 0x00, 0x7f, 0x7f, 0x40, 0x40, 0x40, 0x40, 0x00,
-  0x7f, 0x7f, 0x06, 0x0c, 0x06, 0x7f, 0x7f, 0x00, 0x00, 0x7f, 0x7e, 0x0c,
-  0x18, 0x3f, 0x7f, 0x00, 0x00, 0x3e, 0x7f, 0x41, 0x41, 0x7f, 0x3e, 0x00,
-  0x00, 0x7f, 0x7f, 0x09, 0x09, 0x0f, 0x06, 0x00, 0x00, 0x3e, 0x7f, 0x41,
-  0x21, 0x7f, 0x5e, 0x00, 0x00, 0x7f, 0x7f, 0x09, 0x19, 0x7f, 0x66, 0x00,
-  0x00, 0x26, 0x6f, 0x49, 0x49, 0x7b, 0x32, 0x00, 0x00, 0x01, 0x01, 0x7f,
-  0x7f, 0x01, 0x01, 0x00, 0x00, 0x3f, 0x7f, 0x40, 0x40, 0x7f, 0x3f, 0x00,
-  0x00, 0x1f, 0x3f, 0x60, 0x60, 0x3f, 0x1f, 0x00, 0x7f, 0x7f, 0x30, 0x18,
-  0x30, 0x7f, 0x7f, 0x00, 0x00, 0x63, 0x77, 0x1c, 0x1c, 0x77, 0x63, 0x00,
-  0x00, 0x03, 0x07, 0x7c, 0x7c, 0x07, 0x03, 0x00, 0x00, 0x61, 0x71, 0x59,
-  0x4d, 0x47, 0x43, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x41, 0x41, 0x00, 0x00,
-  0x00, 0x02, 0x01, 0x03, 0x06, 0x04, 0x02, 0x00, 0x00, 0x00, 0x41, 0x41,
-  0x7f, 0x7f, 0x00, 0x00, 0x00, 0x04, 0x06, 0x03, 0x03, 0x06, 0x04, 0x00,
-  0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x03, 0x07,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x38, 0x7c, 0x44, 0x44, 0x3c, 0x78, 0x40,
-  0x00, 0x7f, 0x7f, 0x44, 0x44, 0x7c, 0x38, 0x00, 0x00, 0x38, 0x7c, 0x44,
-  0x44, 0x6c, 0x28, 0x00, 0x00, 0x38, 0x7c, 0x44, 0x44, 0x7f, 0x7f, 0x40,
-  0x00, 0x38, 0x7c, 0x54, 0x54, 0x5c, 0x58, 0x00, 0x00, 0x7e, 0x7f, 0x09,
-  0x09, 0x03, 0x02, 0x00, 0x00, 0x98, 0xbc, 0xa4, 0xa4, 0xfc, 0x78, 0x00,
-  0x00, 0x7f, 0x7f, 0x04, 0x04, 0x7c, 0x78, 0x00, 0x00, 0x00, 0x44, 0x7d,
-  0x7d, 0x40, 0x00, 0x00, 0x00, 0x40, 0xc0, 0x80, 0xfd, 0x7d, 0x00, 0x00,
-  0x00, 0x7f, 0x7f, 0x18, 0x1c, 0x74, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3f,
-  0x7f, 0x40, 0x40, 0x00, 0x00, 0x78, 0x0c, 0x78, 0x0c, 0x7c, 0x78, 0x00,
-  0x00, 0x7c, 0x78, 0x0c, 0x04, 0x7c, 0x78, 0x00, 0x00, 0x38, 0x7c, 0x44,
-  0x44, 0x7c, 0x38, 0x00, 0x00, 0xfc, 0xfc, 0x44, 0x44, 0x7c, 0x38, 0x00,
-  0x00, 0x38, 0x7c, 0x44, 0x44, 0xfc, 0xfc, 0x00, 0x00, 0x7c, 0x7c, 0x04,
-  0x04, 0x1c, 0x18, 0x00, 0x00, 0x48, 0x5c, 0x54, 0x54, 0x74, 0x24, 0x00,
-  0x00, 0x00, 0x3f, 0x7f, 0x44, 0x44, 0x40, 0x00, 0x00, 0x3c, 0x7c, 0x40,
-  0x40, 0x7c, 0x7c, 0x40, 0x00, 0x1c, 0x3c, 0x60, 0x60, 0x3c, 0x1c, 0x00,
-  0x00, 0x1c, 0x7c, 0x60, 0x38, 0x60, 0x7c, 0x1c, 0x00, 0x44, 0x6c, 0x38,
-  0x38, 0x6c, 0x44, 0x00, 0x00, 0x1c, 0xbc, 0xa0, 0xa0, 0xfc, 0x7c, 0x00,
-  0x00, 0x44, 0x64, 0x74, 0x5c, 0x4c, 0x44, 0x00, 0x00, 0x08, 0x3e, 0x77,
-  0x41, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x41, 0x41, 0x77, 0x3e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3e, 0x22, 0x22, 0x22, 0x22, 0x1c, 0x00, 0x1e, 0x20, 0x20, 0x20, 0x20,
-  0x1e, 0x00, 0x1c, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x3e, 0x08, 0x14,
-  0x14, 0x22, 0x22, 0x00, 0x3e, 0x0a, 0x0a, 0x0a, 0x0a, 0x04, 0x00, 0x1c,
-  0x22, 0x22, 0x22, 0x22, 0x1c, 0x00, 0x3e, 0x02, 0x04, 0x08, 0x10, 0x20,
-  0x3e, 0x00, 0x3e, 0x22, 0x22, 0x22, 0x22, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x2a, 0x1c, 0x3e, 0x3e, 0x1c, 0x2a, 0x00, 0x00, 0x00, 0x7e, 0x43,
-  0x43, 0x7e, 0x00, 0x00, 0x00, 0x24, 0x7e, 0x24, 0x24, 0x7e, 0x24, 0x00,
-  0x00, 0x3e, 0x3e, 0x0a, 0x0a, 0x3e, 0x34, 0x00, 0x00, 0x1c, 0x3e, 0x22,
-  0x2a, 0x3a, 0x38, 0x00, 0x00, 0x3e, 0x3e, 0x2a, 0x2a, 0x3e, 0x14, 0x00,
-  0x7f, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7f, 0x41, 0x5d, 0x5d,
-  0x41, 0x41, 0x41, 0x41, 0x7f, 0x41, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x5d, 0x5d, 0x5d, 0x5d,
-  0x41, 0x41, 0x41, 0x41, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7f, 0x5d, 0x5d, 0x5d, 0x5d,
-  0x41, 0x41, 0x41, 0x7f, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x41, 0x7f,
-  0xff, 0x01, 0x7d, 0x15, 0x15, 0x69, 0x01, 0xff, 0xff, 0x01, 0x39, 0x45,
-  0x55, 0x31, 0x01, 0xff, 0xff, 0x01, 0x7d, 0x55, 0x55, 0x29, 0x01, 0xff,
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3c, 0x42, 0x81, 0x81,
-  0x81, 0x81, 0x42, 0x3c, 0x00, 0x04, 0x48, 0x3a, 0x3e, 0x48, 0x04, 0x00,
-  0x00, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18, 0x00, 0x42, 0xe7, 0x7e, 0x3c,
-  0x3c, 0x7e, 0xe7, 0x42, 0x30, 0x70, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x22, 0x22, 0x22,
-  0x22, 0x1c, 0x00, 0x1e, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x00, 0x1c, 0x22,
-  0x22, 0x22, 0x22, 0x22, 0x00, 0x3e, 0x08, 0x14, 0x14, 0x22, 0x22, 0x00,
-  0x3e, 0x0a, 0x0a, 0x0a, 0x0a, 0x04, 0x00, 0x1c, 0x22, 0x22, 0x22, 0x22,
-  0x1c, 0x00, 0x3e, 0x02, 0x04, 0x08, 0x10, 0x20, 0x3e, 0x00, 0x3e, 0x22,
-  0x22, 0x22, 0x22, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1c, 0x06, 0x02,
-  0x83, 0xc1, 0xe1, 0x71, 0x71, 0x31, 0x71, 0x71, 0xe1, 0xc1, 0x81, 0x01,
-  0xc1, 0xf1, 0xf1, 0x01, 0x01, 0x01, 0xe1, 0xf1, 0xf1, 0x01, 0x01, 0x01,
-  0x01, 0x81, 0xe1, 0xf1, 0x81, 0x01, 0x01, 0x01, 0x81, 0xc1, 0xe1, 0x71,
-  0x71, 0x31, 0x31, 0x71, 0xe1, 0x61, 0x01, 0xf1, 0xf1, 0x31, 0x81, 0xc1,
-  0xf1, 0x71, 0x31, 0x11, 0x01, 0xe1, 0xe1, 0xe1, 0x01, 0x03, 0x06, 0xfc,
-  0xff, 0x00, 0x00, 0x00, 0x3f, 0x7f, 0x71, 0xe0, 0xc0, 0xd8, 0xfc, 0xf0,
-  0xff, 0xff, 0x1f, 0x00, 0x7f, 0x7f, 0xe7, 0xc0, 0xc0, 0xf0, 0x7f, 0x3f,
-  0x03, 0xc0, 0xf0, 0x7c, 0x3f, 0x37, 0x33, 0x3f, 0xff, 0xf8, 0xc0, 0x00,
-  0x3f, 0x7f, 0x79, 0xe0, 0xe0, 0xc0, 0xe0, 0xe0, 0x40, 0x00, 0xfe, 0xff,
-  0x3f, 0x07, 0x3f, 0xff, 0xf0, 0xc0, 0x00, 0x00, 0xe0, 0xef, 0x6f, 0x01,
-  0x00, 0x00, 0x80, 0xff, 0x03, 0x06, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0x18, 0x10, 0x10, 0x30, 0x20, 0x68,
-  0xd8, 0xf8, 0xc8, 0x88, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x0c, 0x04, 0x06, 0x03, 0x00, 0x3c, 0x42, 0xad, 0xa1,
-  0xad, 0x91, 0x42, 0x3c, 0x3c, 0x42, 0x8d, 0xa1, 0xad, 0x81, 0x42, 0x3c,
-  0x3c, 0x42, 0x8d, 0xa1, 0xa1, 0x8d, 0x42, 0x3c, 0x3c, 0x42, 0x89, 0xa1,
-  0xa1, 0x89, 0x42, 0x3c, 0x3c, 0x42, 0x81, 0xa9, 0xa1, 0x89, 0x42, 0x3c,
-  0x3c, 0x42, 0x8d, 0xa1, 0xa1, 0x8d, 0x42, 0x3c, 0x3c, 0x42, 0x81, 0xad,
-  0xa1, 0x8d, 0x42, 0x3c, 0x3c, 0x42, 0x91, 0xad, 0xa1, 0xad, 0x42, 0x3c,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x41, 0x41,
-  0x7f, 0x3e, 0x00, 0x3f, 0x7f, 0x40, 0x40, 0x7f, 0x3f, 0x00, 0x3e, 0x7f,
-  0x41, 0x41, 0x41, 0x00, 0x7f, 0x7f, 0x1c, 0x36, 0x63, 0x41, 0x00, 0x7f,
-  0x7f, 0x09, 0x09, 0x0f, 0x06, 0x00, 0x3e, 0x7f, 0x41, 0x41, 0x7f, 0x3e,
-  0x00, 0x7f, 0x7f, 0x06, 0x0c, 0x18, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x41,
-  0x41, 0x7f, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1c, 0x06, 0x02,
-  0xfb, 0xf9, 0xf9, 0xf9, 0xf1, 0xe1, 0xc1, 0x01, 0x01, 0xf9, 0xf9, 0xf9,
-  0xf9, 0x01, 0x01, 0xc1, 0xe1, 0xf1, 0xf9, 0x79, 0x39, 0x3d, 0x3d, 0x39,
-  0x79, 0xf9, 0xf1, 0xe1, 0x81, 0x01, 0x01, 0x39, 0xf9, 0xf9, 0xf1, 0x81,
-  0x01, 0x81, 0xf1, 0xf9, 0xf9, 0xf9, 0xf1, 0x81, 0x01, 0x01, 0xe1, 0xf9,
-  0xf9, 0x79, 0x09, 0x01, 0xf9, 0xf9, 0xf9, 0xf9, 0x01, 0x03, 0x06, 0xfc,
-  0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x07, 0x0f, 0x1f,
-  0x7e, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x1f, 0x3f, 0x7f, 0xff, 0xf0,
-  0xe0, 0xe0, 0xe0, 0xe0, 0xf0, 0x7f, 0x7f, 0x3f, 0x0f, 0x00, 0x00, 0x00,
-  0x01, 0x0f, 0x7f, 0xff, 0xfc, 0xff, 0x3f, 0x0f, 0x01, 0x07, 0x3f, 0xff,
-  0xfc, 0xff, 0xff, 0x1f, 0x03, 0x00, 0x00, 0x00, 0xe0, 0xef, 0xef, 0xe0,
-  0x00, 0x00, 0x80, 0xff, 0x03, 0x06, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0x18, 0x10, 0x10, 0x30, 0x20, 0x68,
-  0xd8, 0xf8, 0xc8, 0x88, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x0c, 0x04, 0x06, 0x03, 0x00, 0x80, 0x00, 0x00, 0x80,
-  0x80, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xc0, 0x80, 0x80, 0xc0, 0xc0,
-  0x80, 0xc0, 0xc0, 0xc0, 0xe0, 0xc0, 0xc0, 0xe0, 0xe0, 0xc0, 0xe0, 0xe0,
-  0xe0, 0xe0, 0xf0, 0xe0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe0, 0xf0,
-  0xe0, 0xe0, 0xe0, 0xc0, 0xe0, 0xe0, 0xc0, 0xc0, 0xe0, 0xc0, 0xc0, 0x80,
-  0x00, 0xc0, 0x20, 0x20, 0x20, 0x30, 0x8c, 0x22, 0x21, 0x25, 0x25, 0xa5,
-  0xbd, 0x01, 0xbd, 0xa5, 0x25, 0x21, 0x23, 0x2f, 0x39, 0x25, 0x25, 0xe5,
-  0x31, 0xa1, 0xa5, 0xb5, 0x35, 0x31, 0xa6, 0xac, 0xa8, 0xa0, 0x20, 0xa0,
-  0xa0, 0x20, 0xc0, 0x00, 0x06, 0x16, 0x22, 0x20, 0x00, 0x70, 0x89, 0x20,
-  0x00, 0x00, 0x40, 0x00, 0x41, 0x40, 0x41, 0x40, 0x40, 0x00, 0x70, 0x88,
-  0x20, 0x00, 0x20, 0x1d, 0x00, 0x25, 0x05, 0x25, 0x00, 0x20, 0x0c, 0x2c,
-  0x0c, 0x2c, 0x80, 0x25, 0x05, 0x24, 0x0c, 0x00, 0x00, 0x00, 0xf0, 0x0c,
-  0xe2, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-  0x01, 0x01, 0x01, 0x05, 0x09, 0xf1, 0x05, 0x1d, 0x0d, 0xc5, 0x31, 0x09,
-  0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-  0x7e, 0x01, 0x81, 0xa1, 0x01, 0x21, 0x21, 0x21, 0x21, 0x21, 0x01, 0x21,
-  0x1e, 0x60, 0xc0, 0x80, 0x00, 0x00, 0xff, 0x40, 0x47, 0x40, 0x00, 0x00,
-  0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x08, 0x04, 0x02,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x0c, 0x8a, 0x89,
-  0x03, 0xf6, 0x00, 0x60, 0x64, 0x04, 0xe4, 0x45, 0xa5, 0x44, 0xa4, 0x41,
-  0xa3, 0x42, 0xe0, 0x04, 0xec, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-  0x05, 0x05, 0x05, 0x04, 0x04, 0x00, 0x78, 0x84, 0x30, 0x00, 0x83, 0x0a,
-  0x0a, 0x0a, 0x0a, 0x02, 0x0a, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0a, 0x02, 0x0a, 0x0a, 0x08,
-  0x0a, 0x01, 0x3c, 0x42, 0x99, 0xa5, 0x81, 0x00, 0x1b, 0x02, 0x02, 0x02,
-  0x02, 0x3a, 0x42, 0x9a, 0xa2, 0x02, 0x42, 0x18, 0x01, 0x00, 0x00, 0x00,
-  0x1d, 0x05, 0x05, 0x05, 0x01, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x05,
-  0x05, 0x05, 0x1d, 0x00, 0x09, 0x05, 0x09, 0x05, 0x09, 0x05, 0x09, 0x01,
-  0x1d, 0x15, 0x19, 0x15, 0x19, 0x15, 0x1d, 0x1d, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x7e, 0xfc, 0xfc,
-  0xfc, 0x7e, 0x7f, 0x3f, 0x1f, 0xcf, 0x0e, 0x06, 0xe0, 0xf1, 0x71, 0x02,
-  0x02, 0x71, 0xf1, 0xe0, 0x06, 0x0e, 0xcf, 0x1f, 0x3f, 0x7f, 0x7e, 0xfc,
-  0xfc, 0xfc, 0x7e, 0x3e, 0x00, 0x00, 0x70, 0x98, 0xac, 0x84, 0x84, 0x94,
-  0x84, 0xa4, 0x8c, 0x98, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x78, 0xd4, 0xbc, 0x7c, 0xac, 0x54, 0xa8, 0x70, 0xc0,
-  0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xdb, 0xf8, 0xf8,
-  0xd3, 0x77, 0xe2, 0xd0, 0xd0, 0xe2, 0x77, 0xd3, 0xf8, 0xf8, 0xdb, 0xf0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x40, 0xb0, 0x58, 0xac,
-  0x5c, 0xbf, 0x54, 0xac, 0x78, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02,
-  0x03, 0x02, 0x05, 0x0a, 0x15, 0x3a, 0x35, 0x6b, 0xf6, 0xee, 0xd4, 0xa8,
-  0x40, 0x8d, 0x3b, 0x62, 0x43, 0x43, 0x59, 0x48, 0x48, 0x59, 0x43, 0xc3,
-  0x62, 0xbb, 0x4d, 0xa0, 0x58, 0xac, 0xd6, 0xea, 0x75, 0x3b, 0x15, 0x1a,
-  0x0d, 0x06, 0x03, 0x02, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x03, 0xff, 0x5f, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa,
-  0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xbe, 0xff, 0x03, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x00, 0x44, 0x4a,
-  0x4a, 0x4a, 0x30, 0x00, 0x7e, 0x4a, 0x4a, 0x42, 0x40, 0x00, 0x02, 0x02,
-  0x7e, 0x02, 0x02, 0x00, 0x02, 0x02, 0x7e, 0x02, 0x02, 0x00, 0x7e, 0x00,
-  0x7e, 0x04, 0x08, 0x10, 0x20, 0x7e, 0x00, 0x3c, 0x42, 0x52, 0x52, 0x72,
-  0x00, 0x44, 0x4a, 0x4a, 0x4a, 0x30, 0x00, 0x24, 0x24, 0x24, 0x24, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xc3, 0xdb, 0xdb, 0xdb, 0xe7, 0xff, 0xe3, 0xdf,
-  0xdf, 0xdf, 0xe3, 0xff, 0xe7, 0xdb, 0xdb, 0xdb, 0xdf, 0xff, 0xc3, 0xf7,
-  0xf7, 0xeb, 0xdf, 0xff, 0xff, 0x81, 0x81, 0x81, 0xbd, 0x95, 0x95, 0x95,
-  0xa9, 0x81, 0xbd, 0x81, 0xbd, 0x85, 0x89, 0x91, 0xa1, 0xbd, 0x81, 0x99,
-  0xa5, 0xa5, 0xb5, 0xb1, 0x81, 0x81, 0x81, 0xff, 0xff, 0x81, 0x81, 0x81,
-  0xbd, 0xa5, 0xa5, 0xa5, 0x99, 0x81, 0x9d, 0xa1, 0xa1, 0xa1, 0x9d, 0x81,
-  0x99, 0xa5, 0xa5, 0xa5, 0xa1, 0x81, 0xbd, 0x89, 0x89, 0x95, 0xa1, 0x81,
-  0x81, 0xff, 0xff, 0xff, 0xc3, 0xeb, 0xeb, 0xeb, 0xd7, 0xff, 0xc3, 0xff,
-  0xc3, 0xfb, 0xf7, 0xef, 0xdf, 0xc3, 0xff, 0xe7, 0xdb, 0xdb, 0xcb, 0xcf,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x24, 0x24, 0x24,
-  0x18, 0x00, 0x1c, 0x20, 0x20, 0x20, 0x1c, 0x00, 0x18, 0x24, 0x24, 0x24,
-  0x20, 0x00, 0x3c, 0x08, 0x08, 0x14, 0x20, 0x00, 0x00, 0x7e, 0x7e, 0x7e,
-  0x42, 0x6a, 0x6a, 0x6a, 0x56, 0x7e, 0x42, 0x7e, 0x42, 0x7a, 0x76, 0x6e,
-  0x5e, 0x42, 0x7e, 0x66, 0x5a, 0x5a, 0x4a, 0x4e, 0x7e, 0x7e, 0x7e, 0x00,
-  0x00, 0x7e, 0x7e, 0x7e, 0x42, 0x5a, 0x5a, 0x5a, 0x66, 0x7e, 0x62, 0x5e,
-  0x5e, 0x5e, 0x62, 0x7e, 0x66, 0x5a, 0x5a, 0x5a, 0x5e, 0x7e, 0x42, 0x76,
-  0x76, 0x6a, 0x5e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x3c, 0x14, 0x14, 0x14,
-  0x28, 0x00, 0x3c, 0x00, 0x3c, 0x04, 0x08, 0x10, 0x20, 0x3c, 0x00, 0x18,
-  0x24, 0x24, 0x34, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x66, 0x5a, 0x5a, 0x5a, 0x66, 0x7e, 0x42,
-  0x7a, 0x76, 0x6e, 0x42, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 0x24, 0x24, 0x18,
-  0x00, 0x3c, 0x14, 0x14, 0x04, 0x00, 0x3c, 0x14, 0x14, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x18, 0x24, 0x24, 0x24, 0x18, 0x00, 0x3c, 0x04, 0x08, 0x10, 0x3c,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x66, 0x5a, 0x5a, 0x5a, 0x66, 0x7e, 0x42, 0x6a, 0x6a,
-  0x7a, 0x7e, 0x42, 0x6a, 0x6a, 0x7a, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00,
-  0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
-  0x24, 0x24, 0x24, 0x00, 0x7e, 0x0a, 0x0a, 0x0a, 0x74, 0x00, 0x7c, 0x0a,
-  0x0a, 0x0a, 0x7c, 0x00, 0x7e, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x7e, 0x00,
-  0x3c, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
-  0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x40, 0x30, 0x18, 0x08,
-  0x0c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0c, 0x18, 0x60,
-  0x01, 0x06, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x18, 0x18, 0x10, 0x10, 0x30, 0x20, 0x68, 0xd8, 0xf8, 0xc8, 0x88,
-  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0c,
-  0x04, 0x06, 0x02, 0x01, 0x00, 0x04, 0x04, 0x3c, 0x3c, 0x04, 0x04, 0x00,
-  0x3c, 0x42, 0xe1, 0xf1, 0xf9, 0xfd, 0x7e, 0x3c, 0x00, 0x18, 0x18, 0x18,
-  0x7e, 0x3c, 0x18, 0x00, 0x3c, 0x42, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x00, 0x44, 0x4e, 0x4a, 0x4a, 0x4a, 0x7a, 0x30, 0x00,
-  0x7e, 0x7e, 0x4a, 0x4a, 0x4a, 0x42, 0x42, 0x00, 0x7e, 0x7e, 0x0c, 0x18,
-  0x30, 0x7e, 0x7e, 0x00, 0x7e, 0x7e, 0x42, 0x42, 0x42, 0x7e, 0x3c, 0x00,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3c,
-  0x3c, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xbb, 0xb1, 0xb5, 0xb5, 0xb5, 0x85, 0xcf, 0xff, 0x81, 0x81, 0xb5, 0xb5,
-  0xb5, 0xbd, 0xbd, 0xff, 0x81, 0x81, 0xf3, 0xe7, 0xcf, 0x81, 0x81, 0xff,
-  0x81, 0x81, 0xbd, 0xbd, 0xbd, 0x81, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x3c, 0x00, 0x24, 0x24, 0x24,
-  0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x7e,
-  0x04, 0x08, 0x10, 0x20, 0x7e, 0x00, 0x7c, 0x0a, 0x0a, 0x0a, 0x7c, 0x00,
-  0x7e, 0x04, 0x08, 0x10, 0x08, 0x04, 0x7e, 0x00, 0x7e, 0x4a, 0x4a, 0x4a,
-  0x42, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
-  0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x7e, 0x04, 0x08, 0x10, 0x08, 0x04,
-  0x7e, 0x00, 0x7e, 0x4a, 0x4a, 0x4a, 0x42, 0x00, 0x44, 0x4a, 0x4a, 0x4a,
-  0x4a, 0x30, 0x00, 0x44, 0x4a, 0x4a, 0x4a, 0x4a, 0x30, 0x00, 0x7c, 0x0a,
-  0x0a, 0x0a, 0x7c, 0x00, 0x3c, 0x42, 0x52, 0x52, 0x72, 0x00, 0x7e, 0x4a,
-  0x4a, 0x42, 0x42, 0x00, 0x44, 0x4a, 0x4a, 0x4a, 0x4a, 0x30, 0x00, 0x00,
-  0x30, 0x38, 0x3c, 0x3e, 0x3e, 0x3c, 0x38, 0x30, 0x00, 0x24, 0x2a, 0x2a,
-  0x2a, 0x12, 0x00, 0x24, 0x2a, 0x2a, 0x2a, 0x12, 0x00, 0x3e, 0x22, 0x22,
-  0x22, 0x1c, 0x00, 0x02, 0x3e, 0x00, 0x22, 0x2a, 0x2a, 0x2a, 0x14, 0x00,
-  0x1c, 0x22, 0x22, 0x22, 0x1c, 0x00, 0x1c, 0x2a, 0x2a, 0x2a, 0x10, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x2a, 0x2a, 0x2a, 0x12,
-  0x00, 0x22, 0x14, 0x08, 0x14, 0x22, 0x00, 0x02, 0x3e, 0x00, 0x32, 0x2a,
-  0x2a, 0x2a, 0x24, 0x00, 0x14, 0x2a, 0x2a, 0x2a, 0x14, 0x00, 0x1c, 0x22,
-  0x22, 0x22, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x2a,
-  0x2a, 0x2a, 0x14, 0x00, 0x1c, 0x22, 0x22, 0x22, 0x5c, 0x00, 0x32, 0x2a,
-  0x2a, 0x2a, 0x24, 0x00, 0x18, 0x14, 0x12, 0x3e, 0x10, 0x00, 0x32, 0x2a,
-  0x2a, 0x2a, 0x24, 0x00, 0x04, 0x2a, 0x2a, 0x2a, 0x1c, 0x00, 0x2e, 0x2a,
-  0x2a, 0x2a, 0x12, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x0a, 0x0a, 0x0a, 0x02,
-  0x00, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x00, 0x32, 0x2a, 0x2a, 0x2a, 0x24,
-  0x00, 0x2e, 0x2a, 0x2a, 0x2a, 0x12, 0x00, 0x3e, 0x08, 0x08, 0x08, 0x3e,
-  0x00, 0x02, 0x3e, 0x00, 0x1c, 0x2a, 0x2a, 0x2a, 0x10, 0x00, 0x24, 0x2a,
-  0x2a, 0x2a, 0x12, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
-  0x24, 0x24, 0x24, 0x24, 0x00, 0x44, 0x4a, 0x4a, 0x4a, 0x4a, 0x30, 0x02,
-  0x02, 0x7e, 0x02, 0x02, 0x00, 0x7c, 0x0a, 0x0a, 0x0a, 0x7c, 0x00, 0x02,
-  0x02, 0x7e, 0x02, 0x02, 0x00, 0x44, 0x4a, 0x4a, 0x4a, 0x4a, 0x30, 0x00,
-  0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00,
-  0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x7e, 0x08,
-  0x08, 0x08, 0x7e, 0x00, 0x7e, 0x00, 0x44, 0x4a, 0x4a, 0x4a, 0x30, 0x00,
-  0x02, 0x02, 0x7e, 0x02, 0x02, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x3c, 0x00,
-  0x7e, 0x0a, 0x0a, 0x0a, 0x74, 0x00, 0x02, 0x04, 0x78, 0x04, 0x02, 0x00,
-  0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
-  0xfe, 0xfe, 0xfe, 0xfe, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x5c, 0x7e, 0x7e, 0x3e, 0x1c, 0x00, 0x5c, 0x7e, 0x7e, 0x3e,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0xfc, 0xfc, 0xfc, 0x70,
-  0x70, 0xfc, 0xfc, 0xfc, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf8,
-  0xf8, 0x98, 0x9e, 0x9e, 0x9e, 0x98, 0x98, 0x98, 0x18, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x30, 0x78, 0x78, 0x30, 0x80, 0xc0, 0xe0, 0xf0, 0x78, 0x3c,
-  0x1c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x70, 0xf8, 0xf8, 0x98, 0x9e, 0x9e,
-  0x9e, 0x98, 0x98, 0x98, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x7e,
-  0x7e, 0x3e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xfc, 0xfe, 0xfe, 0x06, 0x02, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x06, 0xfe,
-  0xfe, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x98,
-  0xf8, 0xf0, 0xf0, 0xfc, 0xfc, 0xf0, 0xf0, 0xf8, 0x98, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xf8, 0xf8, 0x80, 0x80, 0x80,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0,
-  0xe0, 0xf0, 0x78, 0x3c, 0x1c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xfc,
-  0xfe, 0x0e, 0xc6, 0xc6, 0xc6, 0x0e, 0xfe, 0xfc, 0xf8, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x18, 0x1c, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x86, 0xc6, 0xc6, 0xc6, 0xc6,
-  0xc6, 0xee, 0xfe, 0x7c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-  0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xee, 0xfe, 0xfc, 0x38, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf0, 0x78, 0x3c, 0xfe, 0xfe, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0xc6, 0xc6, 0xc6,
-  0xc6, 0xc6, 0xc6, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xfc,
-  0xfe, 0xce, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x86, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x86, 0xc6, 0xe6, 0xfe, 0x7e,
-  0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xfc, 0xfe, 0xee, 0xc6, 0xc6,
-  0xc6, 0xee, 0xfe, 0xfc, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xfc,
-  0xfe, 0xce, 0x86, 0x86, 0x86, 0x8e, 0xfe, 0xfc, 0xf8, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x38, 0x7c, 0x7c, 0x7c, 0x38, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x7c, 0x7c, 0x7c, 0x38,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0xc0, 0xe0, 0xf0, 0x78, 0x3c, 0x1e, 0x0e, 0x06, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x0e, 0x1e, 0x3c,
-  0x78, 0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x3c,
-  0x3e, 0x0e, 0x06, 0x86, 0x86, 0xce, 0xfe, 0xfc, 0x78, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xfc, 0xfe, 0xff, 0x17, 0x17, 0xff, 0xff, 0x17, 0x17, 0xff,
-  0xfe, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf8, 0xfc, 0xce, 0xc6, 0xc6,
-  0xc6, 0xce, 0xfc, 0xf8, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe,
-  0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xee, 0xfe, 0xfc, 0x38, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf8, 0xfc, 0xfe, 0x0e, 0x06, 0x06, 0x06, 0x06, 0x0e, 0x0e,
-  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x06, 0x06, 0x06,
-  0x06, 0x0e, 0xfe, 0xfc, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe,
-  0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xfe, 0xfe, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x06, 0x06,
-  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xfc, 0xfe, 0x0e, 0x06, 0xc6,
-  0xc6, 0xc6, 0xce, 0xce, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe,
-  0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0xfe, 0xfe, 0x06, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe,
-  0xfe, 0xc0, 0xc0, 0xe0, 0xf0, 0xf8, 0x3e, 0x1e, 0x0e, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfc, 0x38, 0x70, 0xe0,
-  0x70, 0x38, 0xfc, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe,
-  0xfc, 0x78, 0xf0, 0xe0, 0xc0, 0x80, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf8, 0xfc, 0xfe, 0x0e, 0x06, 0x06, 0x06, 0x0e, 0xfe, 0xfc,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0xc6, 0xc6, 0xc6,
-  0xc6, 0xee, 0xfe, 0x7c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xfc,
-  0xfe, 0x0e, 0x06, 0x06, 0x06, 0x0e, 0xfe, 0xfc, 0xf8, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xfe, 0xfe, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xee, 0xfe, 0x7c,
-  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x7c, 0xfe, 0xee, 0xc6, 0xc6,
-  0xc6, 0xc6, 0xc6, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06,
-  0x06, 0x06, 0xfe, 0xfe, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xfe, 0xfe, 0xc0, 0x00, 0x00,
-  0x00, 0xc0, 0xfe, 0xfe, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe,
-  0xfe, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x1e, 0x3e, 0x7e, 0xf0, 0xe0, 0xc0, 0xe0, 0xf0, 0x7e, 0x3e,
-  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x7e, 0xfe, 0xe0, 0xc0, 0x80,
-  0xc0, 0xe0, 0xfe, 0x7e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06,
-  0x06, 0x86, 0xc6, 0xe6, 0xf6, 0x7e, 0x3e, 0x1e, 0x0e, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x06, 0x06, 0x06, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1c, 0x3c, 0x78, 0xf0, 0xe0, 0xc0,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x06, 0x06, 0x06, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0xc0, 0xe0, 0xf0, 0x78, 0x3c, 0x1e, 0x1e, 0x3c, 0x78, 0xf0,
-  0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08,
-  0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
-  0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18,
-  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00,
-  0x1c, 0x22, 0x41, 0x41, 0x41, 0x22, 0x1c, 0x00, 0x1c, 0x22, 0x5d, 0x5d,
-  0x5d, 0x22, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3d, 0x3d, 0x18,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x0e, 0x3f, 0x3f, 0x3f, 0x0e, 0x0e, 0x3f, 0x3f, 0x3f,
-  0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x18, 0x19, 0x19, 0x19, 0x79, 0x79,
-  0x79, 0x19, 0x1f, 0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x30, 0x38, 0x3c,
-  0x1e, 0x0f, 0x07, 0x03, 0x01, 0x0c, 0x1e, 0x1e, 0x0c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0f, 0x1f, 0x1f, 0x19, 0x79, 0x79, 0x79, 0x19, 0x19, 0x19,
-  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1f, 0x3f, 0x3f, 0x30, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x30, 0x3f, 0x3f, 0x1f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x19, 0x1f, 0x0f, 0x0f, 0x3f,
-  0x3f, 0x0f, 0x0f, 0x1f, 0x19, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x01, 0x01, 0x1f, 0x1f, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x38, 0x7c, 0x7c, 0x7c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3e,
-  0x3e, 0x3e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x30, 0x38, 0x3c, 0x1e, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x3f, 0x38, 0x31, 0x31,
-  0x31, 0x38, 0x3f, 0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-  0x30, 0x39, 0x3f, 0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
-  0x0f, 0x0d, 0x0c, 0x0c, 0x0c, 0x3f, 0x3f, 0x3f, 0x0c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x39, 0x3f, 0x1f,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x3f, 0x38, 0x30, 0x30,
-  0x30, 0x39, 0x3f, 0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0f, 0x1f, 0x3f, 0x39, 0x30, 0x30, 0x30, 0x39, 0x3f, 0x1f,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x31, 0x31, 0x31,
-  0x31, 0x39, 0x3f, 0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
-  0x3e, 0x3e, 0x3e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x5c, 0x7e, 0x7e, 0x3e, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0f,
-  0x1e, 0x3c, 0x38, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x20, 0x30, 0x38, 0x3c, 0x1e, 0x0f, 0x07, 0x03, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x37,
-  0x37, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x3f,
-  0x7f, 0x7f, 0x77, 0x77, 0x77, 0x77, 0x7f, 0x7f, 0x3f, 0x1f, 0x00, 0x00,
-  0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f,
-  0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x30,
-  0x30, 0x39, 0x3f, 0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f,
-  0x3f, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x38, 0x18, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x38, 0x3f, 0x1f,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x30,
-  0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f,
-  0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0f, 0x1f, 0x3f, 0x38, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f,
-  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x30, 0x3f, 0x3f, 0x3f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x1e, 0x3e, 0x38, 0x30, 0x30, 0x30, 0x38, 0x3f, 0x1f,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x01,
-  0x03, 0x07, 0x3f, 0x3e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f,
-  0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f,
-  0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x01,
-  0x03, 0x07, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f,
-  0x3f, 0x38, 0x30, 0x30, 0x30, 0x38, 0x3f, 0x1f, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x3f, 0x38, 0x30, 0x30,
-  0x36, 0x3e, 0x3f, 0x1f, 0x3f, 0x38, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f,
-  0x3f, 0x00, 0x00, 0x00, 0x01, 0x03, 0x3f, 0x3f, 0x3e, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x39, 0x3f, 0x1f,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f,
-  0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f,
-  0x3f, 0x38, 0x30, 0x30, 0x30, 0x38, 0x3f, 0x1f, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3f, 0x3c, 0x3f, 0x0f, 0x03, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x1f, 0x0e, 0x07, 0x03,
-  0x07, 0x0e, 0x1f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3e,
-  0x3f, 0x07, 0x03, 0x01, 0x03, 0x07, 0x3f, 0x3e, 0x3c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x3f, 0x3f, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3e, 0x3f, 0x37, 0x33, 0x31,
-  0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0f, 0x1e, 0x3c,
-  0x38, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x3f,
-  0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
-  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-  0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+// Generated by tools/fontconv from font/duck_font_grafx2.gif, do not edit
+
+#define DUCK_FONT_SLOTS 896
+#define DUCK_FONT_INDEX_BLOCK 128
+#define DUCK_FONT_OFFSET_GROUP 16
+#define DUCK_FONT_DATA_SIZE 3781
+#define DUCK_FONT_CHECKSUM 0x53395169UL
+
+static constexpr uint16_t duck_font_base[7] = {
+  0x000, 0x05d, 0x0db, 0x07a, 0x0e6, 0x1c3, 0x1cd,
+};
+
+static constexpr uint8_t duck_font_index[896] = {
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+  0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+  0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23,
+  0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+  0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+  0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+  0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53,
+  0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+  0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b,
+  0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+  0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04,
+  0x05, 0x06, 0x07, 0x08, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+  0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34,
+  0x35, 0x33, 0x33, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x39, 0x3c, 0x3d,
+  0x00, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c,
+  0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x31, 0x33, 0x33, 0x34,
+  0x35, 0x33, 0x33, 0x36, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c,
+  0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x1b,
+  0x68, 0x69, 0x1b, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x00, 0x70, 0x71,
+  0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d,
+  0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+  0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+  0x00, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x00, 0x00, 0x00, 0x15, 0x16,
+  0x17, 0x18, 0x00, 0x00, 0x00, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+  0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b,
+  0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+  0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x00,
+  0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e,
+  0xab, 0xb0, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb3, 0x16, 0x16,
+  0x17, 0x18, 0x16, 0x16, 0xb4, 0xb5, 0xb6, 0x01, 0xb7, 0xb8, 0xb9, 0xba,
+  0xbb, 0xbc, 0xbd, 0xbe, 0xbf, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xaa, 0xc5,
+  0xc6, 0xc7, 0xc8, 0xc9, 0xab, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd0,
+  0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc,
+  0xd5, 0xdd, 0xde, 0xdf, 0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xaa,
+  0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xab, 0xaa, 0xec, 0xed, 0xee, 0xef, 0xf0,
+  0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x86,
+  0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x8c, 0x87, 0x00,
+  0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x00, 0x00, 0x98, 0x99,
+  0x00, 0x00, 0x01, 0x8e, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0xa1,
+  0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa5, 0xa7, 0xa8, 0xa9, 0xa1, 0xaa, 0xab,
+  0xac, 0x00, 0xac, 0x00, 0xa2, 0xad, 0xae, 0xaf, 0xb0, 0xb1, 0xb2, 0xb3,
+  0xb4, 0xb5, 0xb6, 0xb7, 0xa4, 0xa1, 0xb8, 0xb9, 0xba, 0xbb, 0xa4, 0xbc,
+  0xa4, 0xbc, 0xbd, 0xbe, 0xbf, 0xc0, 0xc1, 0xc2, 0x00, 0xc3, 0xc4, 0xc5,
+  0xc3, 0x00, 0xc6, 0xc7, 0xc8, 0xc9, 0xb8, 0xbb, 0xa4, 0x9f, 0xb8, 0xbb,
+  0xa4, 0x9f, 0xca, 0xa5, 0xcb, 0xcc, 0xc3, 0xc3, 0xcd, 0xce, 0xcf, 0xc3,
+  0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb,
+  0xdc, 0xdd, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+  0x09, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+  0x08, 0x09, 0x00, 0x00, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11,
+  0x12, 0x00, 0x13, 0x14, 0x15, 0x00, 0x06, 0x16, 0x17, 0x18, 0x19, 0x1a,
+  0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x1d, 0x1e, 0x21, 0x1e, 0x22, 0x23,
+  0x24, 0x1e, 0x25, 0x26, 0x27, 0x00, 0x28, 0x00, 0x29, 0x2a, 0x2b, 0x2c,
+  0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x33, 0x34, 0x1e, 0x21, 0x35,
+  0x34, 0x36, 0x34, 0x1c, 0x33, 0x00, 0x21, 0x37, 0x33, 0x33, 0x38, 0x39,
+  0x3a, 0x36, 0x3b, 0x3c, 0x34, 0x1c, 0x33, 0x33, 0x3b, 0x3d, 0x21, 0x36,
+  0x33, 0x00, 0x21, 0x3e, 0x33, 0x3f, 0x1d, 0x1e, 0x22, 0x40, 0x21, 0x36,
+  0x41, 0x42, 0x43, 0x44, 0x45, 0x3c, 0x46, 0x23, 0x47, 0x1c, 0x48, 0x49,
+  0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x50,
+};
+
+static constexpr uint16_t duck_font_offset[34] = {
+  0x0000, 0x005e, 0x00c6, 0x0137, 0x01a1, 0x020f, 0x027a, 0x02f3, 0x037f, 0x0405, 0x048e, 0x0511,
+  0x0596, 0x060b, 0x0692, 0x06ff, 0x077f, 0x0804, 0x0870, 0x08f6, 0x097f, 0x09f9, 0x0a65, 0x0ad4,
+  0x0b33, 0x0b92, 0x0bf8, 0x0c57, 0x0cb1, 0x0d1b, 0x0d79, 0x0dd1, 0x0e2b, 0x0e82,
+};
+
+#ifdef ENABLE_ASSET_STORE
+
+// Glyph start within its group, the data is in external flash
+static constexpr uint8_t duck_font_delta[541] = {
+  0x00, 0x03, 0x0a, 0x11, 0x18, 0x1f, 0x26, 0x2a, 0x2f, 0x34, 0x3b, 0x42,
+  0x49, 0x4d, 0x50, 0x57, 0x00, 0x07, 0x0e, 0x15, 0x1c, 0x23, 0x2a, 0x31,
+  0x38, 0x3f, 0x42, 0x46, 0x4c, 0x53, 0x59, 0x60, 0x00, 0x07, 0x0e, 0x15,
+  0x1c, 0x23, 0x2a, 0x31, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5c, 0x63, 0x6a,
+  0x00, 0x07, 0x0e, 0x15, 0x1c, 0x23, 0x2a, 0x32, 0x39, 0x40, 0x47, 0x4c,
+  0x53, 0x58, 0x5f, 0x66, 0x00, 0x08, 0x0f, 0x16, 0x1e, 0x25, 0x2c, 0x33,
+  0x3a, 0x3f, 0x45, 0x4c, 0x52, 0x59, 0x60, 0x67, 0x00, 0x07, 0x0e, 0x15,
+  0x1b, 0x23, 0x2a, 0x32, 0x39, 0x40, 0x47, 0x4d, 0x50, 0x56, 0x5b, 0x63,
+  0x00, 0x07, 0x0f, 0x17, 0x1f, 0x24, 0x2b, 0x30, 0x37, 0x3e, 0x45, 0x4c,
+  0x55, 0x5e, 0x67, 0x70, 0x00, 0x09, 0x12, 0x1b, 0x24, 0x2d, 0x36, 0x3f,
+  0x48, 0x51, 0x58, 0x5f, 0x68, 0x71, 0x7a, 0x83, 0x00, 0x09, 0x12, 0x1b,
+  0x24, 0x2d, 0x33, 0x3b, 0x44, 0x4d, 0x55, 0x5d, 0x64, 0x6b, 0x74, 0x7d,
+  0x00, 0x09, 0x12, 0x1a, 0x23, 0x2c, 0x35, 0x3e, 0x47, 0x50, 0x59, 0x61,
+  0x69, 0x71, 0x79, 0x81, 0x00, 0x07, 0x10, 0x19, 0x22, 0x2b, 0x34, 0x3d,
+  0x46, 0x4f, 0x55, 0x5e, 0x65, 0x6e, 0x74, 0x7d, 0x00, 0x07, 0x0d, 0x16,
+  0x1f, 0x28, 0x31, 0x3a, 0x43, 0x4c, 0x54, 0x5d, 0x66, 0x6f, 0x77, 0x7f,
+  0x00, 0x07, 0x0e, 0x16, 0x1d, 0x26, 0x2f, 0x38, 0x41, 0x46, 0x4d, 0x52,
+  0x57, 0x5f, 0x68, 0x6f, 0x00, 0x07, 0x10, 0x19, 0x22, 0x2a, 0x33, 0x39,
+  0x42, 0x4a, 0x53, 0x5c, 0x65, 0x6e, 0x77, 0x80, 0x00, 0x06, 0x08, 0x11,
+  0x14, 0x1d, 0x26, 0x29, 0x32, 0x35, 0x3d, 0x46, 0x4f, 0x58, 0x61, 0x69,
+  0x00, 0x09, 0x12, 0x16, 0x1d, 0x25, 0x2c, 0x33, 0x3b, 0x43, 0x4a, 0x53,
+  0x5c, 0x65, 0x6e, 0x77, 0x00, 0x09, 0x12, 0x1b, 0x24, 0x2d, 0x36, 0x3f,
+  0x48, 0x4d, 0x54, 0x5c, 0x63, 0x6c, 0x75, 0x7d, 0x00, 0x09, 0x12, 0x18,
+  0x1f, 0x27, 0x2c, 0x34, 0x3d, 0x46, 0x4c, 0x52, 0x59, 0x5c, 0x63, 0x68,
+  0x00, 0x09, 0x12, 0x1a, 0x22, 0x2a, 0x32, 0x3a, 0x41, 0x49, 0x52, 0x5b,
+  0x64, 0x6d, 0x76, 0x7d, 0x00, 0x09, 0x11, 0x19, 0x21, 0x29, 0x31, 0x3a,
+  0x43, 0x4c, 0x55, 0x5e, 0x67, 0x70, 0x79, 0x81, 0x00, 0x08, 0x10, 0x18,
+  0x1f, 0x26, 0x2e, 0x36, 0x3e, 0x45, 0x4c, 0x55, 0x5c, 0x64, 0x6b, 0x73,
+  0x00, 0x02, 0x0a, 0x11, 0x19, 0x20, 0x23, 0x2a, 0x32, 0x3a, 0x41, 0x47,
+  0x4e, 0x56, 0x5e, 0x65, 0x00, 0x08, 0x11, 0x18, 0x20, 0x28, 0x2f, 0x36,
+  0x3e, 0x46, 0x4d, 0x53, 0x55, 0x5b, 0x61, 0x68, 0x00, 0x07, 0x0d, 0x14,
+  0x1b, 0x22, 0x27, 0x2a, 0x2f, 0x32, 0x39, 0x40, 0x46, 0x4c, 0x52, 0x58,
+  0x00, 0x06, 0x0b, 0x0d, 0x14, 0x1a, 0x20, 0x26, 0x2c, 0x31, 0x38, 0x3d,
+  0x44, 0x4b, 0x51, 0x58, 0x00, 0x06, 0x0c, 0x12, 0x18, 0x1e, 0x24, 0x2a,
+  0x31, 0x37, 0x3e, 0x45, 0x4c, 0x52, 0x59, 0x5f, 0x00, 0x06, 0x0c, 0x13,
+  0x19, 0x20, 0x26, 0x2a, 0x2d, 0x31, 0x38, 0x3e, 0x45, 0x4b, 0x52, 0x58,
+  0x00, 0x07, 0x0d, 0x12, 0x17, 0x1c, 0x23, 0x29, 0x30, 0x36, 0x3d, 0x43,
+  0x48, 0x4b, 0x53, 0x55, 0x00, 0x03, 0x0b, 0x13, 0x18, 0x1e, 0x27, 0x2d,
+  0x33, 0x3c, 0x42, 0x47, 0x4f, 0x57, 0x5c, 0x63, 0x00, 0x07, 0x0d, 0x15,
+  0x1b, 0x22, 0x28, 0x2d, 0x30, 0x35, 0x38, 0x3f, 0x46, 0x4c, 0x52, 0x58,
+  0x00, 0x06, 0x0c, 0x0e, 0x15, 0x1b, 0x20, 0x24, 0x2b, 0x31, 0x38, 0x3e,
+  0x45, 0x4b, 0x52, 0x55, 0x00, 0x07, 0x0d, 0x13, 0x19, 0x1f, 0x24, 0x2a,
+  0x30, 0x36, 0x3c, 0x41, 0x44, 0x48, 0x4f, 0x56, 0x00, 0x07, 0x0d, 0x13,
+  0x19, 0x1d, 0x20, 0x27, 0x2c, 0x32, 0x38, 0x3f, 0x45, 0x47, 0x4c, 0x50,
+  0x00, 0x06, 0x0d, 0x11, 0x18, 0x1d, 0x20, 0x23, 0x2a, 0x2f, 0x32, 0x36,
+  0x3a,
+};
+
+#else  // #ifdef ENABLE_ASSET_STORE
+
+static constexpr uint8_t duck_font_data[3781] = {
+  0x18, 0x5f, 0x5f, 0x7e, 0x04, 0x07, 0x03, 0x04, 0x07, 0x03, 0x7e, 0x14,
+  0x7f, 0x14, 0x7f, 0x7f, 0x14, 0x7e, 0x24, 0x2a, 0x7f, 0x7f, 0x2a, 0x12,
+  0x7e, 0x63, 0x33, 0x18, 0x0c, 0x66, 0x63, 0x7e, 0x3a, 0x7f, 0x4d, 0x7f,
+  0x32, 0x68, 0x1c, 0x04, 0x07, 0x03, 0x3c, 0x1c, 0x3e, 0x63, 0x41, 0x3c,
+  0x41, 0x63, 0x3e, 0x1c, 0x7e, 0x2a, 0x3e, 0x1c, 0x1c, 0x3e, 0x2a, 0x7e,
+  0x08, 0x08, 0x3e, 0x3e, 0x08, 0x08, 0x7e, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x1c, 0x80, 0xe0, 0x60, 0x18, 0x60, 0x60, 0x7e, 0x60, 0x30, 0x18,
+  0x0c, 0x06, 0x03, 0x7e, 0x3e, 0x7f, 0x59, 0x4d, 0x7f, 0x3e, 0x7e, 0x44,
+  0x46, 0x7f, 0x7f, 0x40, 0x40, 0x7e, 0x46, 0x67, 0x71, 0x59, 0x4f, 0x46,
+  0x7e, 0x22, 0x63, 0x49, 0x49, 0x7f, 0x36, 0x7e, 0x38, 0x3c, 0x26, 0x7f,
+  0x7f, 0x20, 0x7e, 0x27, 0x67, 0x45, 0x45, 0x7d, 0x39, 0x7e, 0x3c, 0x7e,
+  0x4b, 0x49, 0x79, 0x30, 0x7e, 0x01, 0x01, 0x71, 0x79, 0x0f, 0x07, 0x7e,
+  0x36, 0x7f, 0x49, 0x49, 0x7f, 0x36, 0x7e, 0x06, 0x4f, 0x49, 0x69, 0x3f,
+  0x1e, 0x18, 0x6c, 0x6c, 0x0e, 0x40, 0x6c, 0x2c, 0x3e, 0x08, 0x1c, 0x36,
+  0x63, 0x41, 0x7e, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x7c, 0x41, 0x63,
+  0x36, 0x1c, 0x08, 0x7e, 0x06, 0x07, 0x51, 0x59, 0x0f, 0x06, 0x7f, 0x1c,
+  0x22, 0x59, 0x55, 0x5d, 0x51, 0x1e, 0x7e, 0x7c, 0x7e, 0x13, 0x13, 0x7e,
+  0x7c, 0x7e, 0x7f, 0x7f, 0x49, 0x49, 0x7f, 0x36, 0x7e, 0x3e, 0x7f, 0x41,
+  0x41, 0x63, 0x22, 0x7e, 0x7f, 0x7f, 0x41, 0x63, 0x3e, 0x1c, 0x7e, 0x7f,
+  0x7f, 0x49, 0x49, 0x41, 0x41, 0x7e, 0x7f, 0x7f, 0x09, 0x09, 0x09, 0x01,
+  0x7e, 0x3e, 0x7f, 0x41, 0x51, 0x73, 0x32, 0x7e, 0x7f, 0x7f, 0x08, 0x08,
+  0x7f, 0x7f, 0x7e, 0x41, 0x41, 0x7f, 0x7f, 0x41, 0x41, 0x7e, 0x20, 0x61,
+  0x41, 0x7f, 0x3f, 0x01, 0x7e, 0x7f, 0x7f, 0x08, 0x1c, 0x77, 0x63, 0x7e,
+  0x7f, 0x7f, 0x40, 0x40, 0x40, 0x40, 0x7f, 0x7f, 0x7f, 0x06, 0x0c, 0x06,
+  0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x0c, 0x18, 0x3f, 0x7f, 0x7e, 0x3e, 0x7f,
+  0x41, 0x41, 0x7f, 0x3e, 0x7e, 0x7f, 0x7f, 0x09, 0x09, 0x0f, 0x06, 0x7e,
+  0x3e, 0x7f, 0x41, 0x21, 0x7f, 0x5e, 0x7e, 0x7f, 0x7f, 0x09, 0x19, 0x7f,
+  0x66, 0x7e, 0x26, 0x6f, 0x49, 0x49, 0x7b, 0x32, 0x7e, 0x01, 0x01, 0x7f,
+  0x7f, 0x01, 0x01, 0x7e, 0x3f, 0x7f, 0x40, 0x40, 0x7f, 0x3f, 0x7e, 0x1f,
+  0x3f, 0x60, 0x60, 0x3f, 0x1f, 0x7f, 0x7f, 0x7f, 0x30, 0x18, 0x30, 0x7f,
+  0x7f, 0x7e, 0x63, 0x77, 0x1c, 0x1c, 0x77, 0x63, 0x7e, 0x03, 0x07, 0x7c,
+  0x7c, 0x07, 0x03, 0x7e, 0x61, 0x71, 0x59, 0x4d, 0x47, 0x43, 0x3c, 0x7f,
+  0x7f, 0x41, 0x41, 0x7e, 0x02, 0x01, 0x03, 0x06, 0x04, 0x02, 0x3c, 0x41,
+  0x41, 0x7f, 0x7f, 0x7e, 0x04, 0x06, 0x03, 0x03, 0x06, 0x04, 0x7e, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x1c, 0x03, 0x07, 0x04, 0xfe, 0x38, 0x7c,
+  0x44, 0x44, 0x3c, 0x78, 0x40, 0x7e, 0x7f, 0x7f, 0x44, 0x44, 0x7c, 0x38,
+  0x7e, 0x38, 0x7c, 0x44, 0x44, 0x6c, 0x28, 0xfe, 0x38, 0x7c, 0x44, 0x44,
+  0x7f, 0x7f, 0x40, 0x7e, 0x38, 0x7c, 0x54, 0x54, 0x5c, 0x58, 0x7e, 0x7e,
+  0x7f, 0x09, 0x09, 0x03, 0x02, 0x7e, 0x98, 0xbc, 0xa4, 0xa4, 0xfc, 0x78,
+  0x7e, 0x7f, 0x7f, 0x04, 0x04, 0x7c, 0x78, 0x3c, 0x44, 0x7d, 0x7d, 0x40,
+  0x3e, 0x40, 0xc0, 0x80, 0xfd, 0x7d, 0x7e, 0x7f, 0x7f, 0x18, 0x1c, 0x74,
+  0x64, 0x7c, 0x01, 0x3f, 0x7f, 0x40, 0x40, 0x7e, 0x78, 0x0c, 0x78, 0x0c,
+  0x7c, 0x78, 0x7e, 0x7c, 0x78, 0x0c, 0x04, 0x7c, 0x78, 0x7e, 0x38, 0x7c,
+  0x44, 0x44, 0x7c, 0x38, 0x7e, 0xfc, 0xfc, 0x44, 0x44, 0x7c, 0x38, 0x7e,
+  0x38, 0x7c, 0x44, 0x44, 0xfc, 0xfc, 0x7e, 0x7c, 0x7c, 0x04, 0x04, 0x1c,
+  0x18, 0x7e, 0x48, 0x5c, 0x54, 0x54, 0x74, 0x24, 0x7c, 0x3f, 0x7f, 0x44,
+  0x44, 0x40, 0xfe, 0x3c, 0x7c, 0x40, 0x40, 0x7c, 0x7c, 0x40, 0x7e, 0x1c,
+  0x3c, 0x60, 0x60, 0x3c, 0x1c, 0xfe, 0x1c, 0x7c, 0x60, 0x38, 0x60, 0x7c,
+  0x1c, 0x7e, 0x44, 0x6c, 0x38, 0x38, 0x6c, 0x44, 0x7e, 0x1c, 0xbc, 0xa0,
+  0xa0, 0xfc, 0x7c, 0x7e, 0x44, 0x64, 0x74, 0x5c, 0x4c, 0x44, 0x3e, 0x08,
+  0x3e, 0x77, 0x41, 0x41, 0x18, 0x77, 0x77, 0x7c, 0x41, 0x41, 0x77, 0x3e,
+  0x08, 0xf0, 0x3e, 0x22, 0x22, 0x22, 0xfb, 0x22, 0x1c, 0x1e, 0x20, 0x20,
+  0x20, 0x20, 0xfd, 0x1e, 0x1c, 0x22, 0x22, 0x22, 0x22, 0x22, 0x7e, 0x3e,
+  0x08, 0x14, 0x14, 0x22, 0x22, 0xbf, 0x3e, 0x0a, 0x0a, 0x0a, 0x0a, 0x04,
+  0x1c, 0xdf, 0x22, 0x22, 0x22, 0x22, 0x1c, 0x3e, 0x02, 0xdf, 0x04, 0x08,
+  0x10, 0x20, 0x3e, 0x3e, 0x22, 0x0f, 0x22, 0x22, 0x22, 0x1c, 0x7e, 0x2a,
+  0x1c, 0x3e, 0x3e, 0x1c, 0x2a, 0x3c, 0x7e, 0x43, 0x43, 0x7e, 0x7e, 0x24,
+  0x7e, 0x24, 0x24, 0x7e, 0x24, 0x7e, 0x3e, 0x3e, 0x0a, 0x0a, 0x3e, 0x34,
+  0x7e, 0x1c, 0x3e, 0x22, 0x2a, 0x3a, 0x38, 0x7e, 0x3e, 0x3e, 0x2a, 0x2a,
+  0x3e, 0x14, 0xff, 0x7f, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0xff,
+  0x7f, 0x41, 0x5d, 0x5d, 0x41, 0x41, 0x41, 0x41, 0xff, 0x7f, 0x41, 0x5d,
+  0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0xff, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0xff, 0x5d, 0x5d, 0x5d, 0x5d, 0x41, 0x41, 0x41, 0x41, 0xff,
+  0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0xff, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x7f, 0xff, 0x5d, 0x5d, 0x5d, 0x5d, 0x41, 0x41,
+  0x41, 0x7f, 0xff, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x41, 0x7f, 0xff,
+  0xff, 0x01, 0x7d, 0x15, 0x15, 0x69, 0x01, 0xff, 0xff, 0xff, 0x01, 0x39,
+  0x45, 0x55, 0x31, 0x01, 0xff, 0xff, 0xff, 0x01, 0x7d, 0x55, 0x55, 0x29,
+  0x01, 0xff, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff,
+  0x3c, 0x42, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3c, 0x7e, 0x04, 0x48, 0x3a,
+  0x3e, 0x48, 0x04, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18, 0xff, 0x42,
+  0xe7, 0x7e, 0x3c, 0x3c, 0x7e, 0xe7, 0x42, 0xff, 0x30, 0x70, 0xe0, 0x70,
+  0x38, 0x1c, 0x0e, 0x07, 0xff, 0xf0, 0x1c, 0x06, 0x02, 0x83, 0xc1, 0xe1,
+  0x71, 0xff, 0x71, 0x31, 0x71, 0x71, 0xe1, 0xc1, 0x81, 0x01, 0xff, 0xc1,
+  0xf1, 0xf1, 0x01, 0x01, 0x01, 0xe1, 0xf1, 0xff, 0xf1, 0x01, 0x01, 0x01,
+  0x01, 0x81, 0xe1, 0xf1, 0xff, 0x81, 0x01, 0x01, 0x01, 0x81, 0xc1, 0xe1,
+  0x71, 0xff, 0x71, 0x31, 0x31, 0x71, 0xe1, 0x61, 0x01, 0xf1, 0xff, 0xf1,
+  0x31, 0x81, 0xc1, 0xf1, 0x71, 0x31, 0x11, 0xff, 0x01, 0xe1, 0xe1, 0xe1,
+  0x01, 0x03, 0x06, 0xfc, 0xf1, 0xff, 0x3f, 0x7f, 0x71, 0xe0, 0x7f, 0xc0,
+  0xd8, 0xfc, 0xf0, 0xff, 0xff, 0x1f, 0xff, 0x7f, 0x7f, 0xe7, 0xc0, 0xc0,
+  0xf0, 0x7f, 0x3f, 0xff, 0x03, 0xc0, 0xf0, 0x7c, 0x3f, 0x37, 0x33, 0x3f,
+  0xf7, 0xff, 0xf8, 0xc0, 0x3f, 0x7f, 0x79, 0xe0, 0xdf, 0xe0, 0xc0, 0xe0,
+  0xe0, 0x40, 0xfe, 0xff, 0x3f, 0x3f, 0x07, 0x3f, 0xff, 0xf0, 0xc0, 0xcf,
+  0xe0, 0xef, 0x6f, 0x01, 0x80, 0xff, 0xff, 0x03, 0x06, 0x0c, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0x08, 0x09, 0x08, 0x08, 0x08,
+  0xff, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xff, 0x08, 0x18,
+  0x18, 0x10, 0x10, 0x30, 0x20, 0x68, 0xff, 0xd8, 0xf8, 0xc8, 0x88, 0x08,
+  0x08, 0x08, 0x08, 0x7f, 0x08, 0x08, 0x08, 0x0c, 0x04, 0x06, 0x03, 0xff,
+  0x3c, 0x42, 0xad, 0xa1, 0xad, 0x91, 0x42, 0x3c, 0xff, 0x3c, 0x42, 0x8d,
+  0xa1, 0xad, 0x81, 0x42, 0x3c, 0xff, 0x3c, 0x42, 0x8d, 0xa1, 0xa1, 0x8d,
+  0x42, 0x3c, 0xff, 0x3c, 0x42, 0x89, 0xa1, 0xa1, 0x89, 0x42, 0x3c, 0xff,
+  0x3c, 0x42, 0x81, 0xa9, 0xa1, 0x89, 0x42, 0x3c, 0xff, 0x3c, 0x42, 0x81,
+  0xad, 0xa1, 0x8d, 0x42, 0x3c, 0xff, 0x3c, 0x42, 0x91, 0xad, 0xa1, 0xad,
+  0x42, 0x3c, 0xbf, 0x7f, 0x7f, 0x41, 0x41, 0x7f, 0x3e, 0x3f, 0xdf, 0x7f,
+  0x40, 0x40, 0x7f, 0x3f, 0x3e, 0x7f, 0xf7, 0x41, 0x41, 0x41, 0x7f, 0x7f,
+  0x1c, 0x36, 0xfb, 0x63, 0x41, 0x7f, 0x7f, 0x09, 0x09, 0x0f, 0xfd, 0x06,
+  0x3e, 0x7f, 0x41, 0x41, 0x7f, 0x3e, 0xfe, 0x7f, 0x7f, 0x06, 0x0c, 0x18,
+  0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x41, 0x41, 0x7f, 0x3e, 0xff, 0xf0, 0x1c,
+  0x06, 0x02, 0xfb, 0xf9, 0xf9, 0xf9, 0xff, 0xf1, 0xe1, 0xc1, 0x01, 0x01,
+  0xf9, 0xf9, 0xf9, 0xff, 0xf9, 0x01, 0x01, 0xc1, 0xe1, 0xf1, 0xf9, 0x79,
+  0xff, 0x39, 0x3d, 0x3d, 0x39, 0x79, 0xf9, 0xf1, 0xe1, 0xff, 0x81, 0x01,
+  0x01, 0x39, 0xf9, 0xf9, 0xf1, 0x81, 0xff, 0x01, 0x81, 0xf1, 0xf9, 0xf9,
+  0xf9, 0xf1, 0x81, 0xff, 0x01, 0x01, 0xe1, 0xf9, 0xf9, 0x79, 0x09, 0x01,
+  0xff, 0xf9, 0xf9, 0xf9, 0xf9, 0x01, 0x03, 0x06, 0xfc, 0xf1, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0x07, 0x0f, 0x1f, 0x7e, 0xff, 0xff, 0xff,
+  0xf9, 0xff, 0x1f, 0x3f, 0x7f, 0xff, 0xf0, 0xff, 0xe0, 0xe0, 0xe0, 0xe0,
+  0xf0, 0x7f, 0x7f, 0x3f, 0xf1, 0x0f, 0x01, 0x0f, 0x7f, 0xff, 0xff, 0xfc,
+  0xff, 0x3f, 0x0f, 0x01, 0x07, 0x3f, 0xff, 0x1f, 0xfc, 0xff, 0xff, 0x1f,
+  0x03, 0xcf, 0xe0, 0xef, 0xef, 0xe0, 0x80, 0xff, 0xd9, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xff, 0x80, 0x80, 0xc0,
+  0xc0, 0x80, 0xc0, 0xc0, 0xc0, 0xff, 0xe0, 0xc0, 0xc0, 0xe0, 0xe0, 0xc0,
+  0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xf0, 0xe0, 0xf0, 0xf0, 0xf0, 0xf0, 0xff,
+  0xf0, 0xf0, 0xe0, 0xf0, 0xe0, 0xe0, 0xe0, 0xc0, 0xff, 0xe0, 0xe0, 0xc0,
+  0xc0, 0xe0, 0xc0, 0xc0, 0x80, 0xfe, 0xc0, 0x20, 0x20, 0x20, 0x30, 0x8c,
+  0x22, 0xff, 0x21, 0x25, 0x25, 0xa5, 0xbd, 0x01, 0xbd, 0xa5, 0xff, 0x25,
+  0x21, 0x23, 0x2f, 0x39, 0x25, 0x25, 0xe5, 0xff, 0x31, 0xa1, 0xa5, 0xb5,
+  0x35, 0x31, 0xa6, 0xac, 0x7f, 0xa8, 0xa0, 0x20, 0xa0, 0xa0, 0x20, 0xc0,
+  0xef, 0x06, 0x16, 0x22, 0x20, 0x70, 0x89, 0x20, 0xf4, 0x40, 0x41, 0x40,
+  0x41, 0x40, 0xdd, 0x40, 0x70, 0x88, 0x20, 0x20, 0x1d, 0xee, 0x25, 0x05,
+  0x25, 0x20, 0x0c, 0x2c, 0x7f, 0x0c, 0x2c, 0x80, 0x25, 0x05, 0x24, 0x0c,
+  0xfc, 0xf0, 0x0c, 0xe2, 0x05, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x05,
+  0x09, 0xf1, 0x05, 0x1d, 0xff, 0x0d, 0xc5, 0x31, 0x09, 0x05, 0x01, 0x01,
+  0x01, 0xff, 0x7e, 0x01, 0x81, 0xa1, 0x01, 0x21, 0x21, 0x21, 0xff, 0x21,
+  0x21, 0x01, 0x21, 0x1e, 0x60, 0xc0, 0x80, 0x3c, 0xff, 0x40, 0x47, 0x40,
+  0x3f, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x1e, 0x08, 0x04, 0x02, 0x01,
+  0x1e, 0x01, 0x02, 0x04, 0x08, 0xbf, 0xe7, 0x0c, 0x8a, 0x89, 0x03, 0xf6,
+  0x60, 0xff, 0x64, 0x04, 0xe4, 0x45, 0xa5, 0x44, 0xa4, 0x41, 0x3f, 0xa3,
+  0x42, 0xe0, 0x04, 0xec, 0xb8, 0xf8, 0x03, 0x05, 0x05, 0x05, 0x04, 0xdd,
+  0x04, 0x78, 0x84, 0x30, 0x83, 0x0a, 0xff, 0x0a, 0x0a, 0x0a, 0x02, 0x0a,
+  0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0xff, 0x02, 0x02, 0x02, 0x0a, 0x02, 0x0a, 0x0a, 0x08, 0x7f, 0x0a, 0x01,
+  0x3c, 0x42, 0x99, 0xa5, 0x81, 0xff, 0x1b, 0x02, 0x02, 0x02, 0x02, 0x3a,
+  0x42, 0x9a, 0x1f, 0xa2, 0x02, 0x42, 0x18, 0x01, 0xff, 0x1d, 0x05, 0x05,
+  0x05, 0x01, 0x05, 0x05, 0x05, 0x7f, 0x05, 0x05, 0x01, 0x05, 0x05, 0x05,
+  0x1d, 0xff, 0x09, 0x05, 0x09, 0x05, 0x09, 0x05, 0x09, 0x01, 0xff, 0x1d,
+  0x15, 0x19, 0x15, 0x19, 0x15, 0x1d, 0x1d, 0xff, 0x3e, 0x7e, 0xfc, 0xfc,
+  0xfc, 0x7e, 0x7f, 0x3f, 0xff, 0x1f, 0xcf, 0x0e, 0x06, 0xe0, 0xf1, 0x71,
+  0x02, 0xff, 0x02, 0x71, 0xf1, 0xe0, 0x06, 0x0e, 0xcf, 0x1f, 0xff, 0x3f,
+  0x7f, 0x7e, 0xfc, 0xfc, 0xfc, 0x7e, 0x3e, 0xfc, 0x70, 0x98, 0xac, 0x84,
+  0x84, 0x94, 0x1f, 0x84, 0xa4, 0x8c, 0x98, 0x70, 0x80, 0x78, 0xff, 0xd4,
+  0xbc, 0x7c, 0xac, 0x54, 0xa8, 0x70, 0xc0, 0x03, 0xc0, 0x80, 0xff, 0xf0,
+  0xdb, 0xf8, 0xf8, 0xd3, 0x77, 0xe2, 0xd0, 0xff, 0xd0, 0xe2, 0x77, 0xd3,
+  0xf8, 0xf8, 0xdb, 0xf0, 0xc0, 0x80, 0xc0, 0xff, 0x40, 0xb0, 0x58, 0xac,
+  0x5c, 0xbf, 0x54, 0xac, 0x03, 0x78, 0x07, 0xfe, 0x01, 0x01, 0x02, 0x03,
+  0x02, 0x05, 0x0a, 0xff, 0x15, 0x3a, 0x35, 0x6b, 0xf6, 0xee, 0xd4, 0xa8,
+  0xff, 0x40, 0x8d, 0x3b, 0x62, 0x43, 0x43, 0x59, 0x48, 0xff, 0x48, 0x59,
+  0x43, 0xc3, 0x62, 0xbb, 0x4d, 0xa0, 0xff, 0x58, 0xac, 0xd6, 0xea, 0x75,
+  0x3b, 0x15, 0x1a, 0x7f, 0x0d, 0x06, 0x03, 0x02, 0x03, 0x01, 0x01, 0xe0,
+  0x01, 0x03, 0xff, 0xff, 0x5f, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa,
+  0xff, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xbe, 0x07, 0xff, 0x03,
+  0x01, 0xde, 0x24, 0x24, 0x24, 0x24, 0x44, 0x4a, 0xf7, 0x4a, 0x4a, 0x30,
+  0x7e, 0x4a, 0x4a, 0x42, 0x7d, 0x40, 0x02, 0x02, 0x7e, 0x02, 0x02, 0x5f,
+  0x02, 0x02, 0x7e, 0x02, 0x02, 0x7e, 0xbf, 0x7e, 0x04, 0x08, 0x10, 0x20,
+  0x7e, 0x3c, 0xef, 0x42, 0x52, 0x52, 0x72, 0x44, 0x4a, 0x4a, 0x7b, 0x4a,
+  0x30, 0x24, 0x24, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xdb,
+  0xdb, 0xdb, 0xff, 0xe7, 0xff, 0xe3, 0xdf, 0xdf, 0xdf, 0xe3, 0xff, 0xff,
+  0xe7, 0xdb, 0xdb, 0xdb, 0xdf, 0xff, 0xc3, 0xf7, 0xff, 0xf7, 0xeb, 0xdf,
+  0xff, 0xff, 0x81, 0x81, 0x81, 0xff, 0xbd, 0x95, 0x95, 0x95, 0xa9, 0x81,
+  0xbd, 0x81, 0xff, 0xbd, 0x85, 0x89, 0x91, 0xa1, 0xbd, 0x81, 0x99, 0xff,
+  0xa5, 0xa5, 0xb5, 0xb1, 0x81, 0x81, 0x81, 0xff, 0xff, 0xff, 0x81, 0x81,
+  0x81, 0xbd, 0xa5, 0xa5, 0xa5, 0xff, 0x99, 0x81, 0x9d, 0xa1, 0xa1, 0xa1,
+  0x9d, 0x81, 0xff, 0x99, 0xa5, 0xa5, 0xa5, 0xa1, 0x81, 0xbd, 0x89, 0xff,
+  0x89, 0x95, 0xa1, 0x81, 0x81, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xeb, 0xeb,
+  0xeb, 0xd7, 0xff, 0xc3, 0xff, 0xff, 0xc3, 0xfb, 0xf7, 0xef, 0xdf, 0xc3,
+  0xff, 0xe7, 0xff, 0xdb, 0xdb, 0xcb, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf0,
+  0x3c, 0x24, 0x24, 0x24, 0x7d, 0x18, 0x1c, 0x20, 0x20, 0x20, 0x1c, 0xdf,
+  0x18, 0x24, 0x24, 0x24, 0x20, 0x3c, 0x08, 0xe7, 0x08, 0x14, 0x20, 0x7e,
+  0x7e, 0x7e, 0xff, 0x42, 0x6a, 0x6a, 0x6a, 0x56, 0x7e, 0x42, 0x7e, 0xff,
+  0x42, 0x7a, 0x76, 0x6e, 0x5e, 0x42, 0x7e, 0x66, 0x7f, 0x5a, 0x5a, 0x4a,
+  0x4e, 0x7e, 0x7e, 0x7e, 0xfe, 0x7e, 0x7e, 0x7e, 0x42, 0x5a, 0x5a, 0x5a,
+  0xff, 0x66, 0x7e, 0x62, 0x5e, 0x5e, 0x5e, 0x62, 0x7e, 0xff, 0x66, 0x5a,
+  0x5a, 0x5a, 0x5e, 0x7e, 0x42, 0x76, 0x1f, 0x76, 0x6a, 0x5e, 0x7e, 0x7e,
+  0x5f, 0x3c, 0x14, 0x14, 0x14, 0x28, 0x3c, 0xbf, 0x3c, 0x04, 0x08, 0x10,
+  0x20, 0x3c, 0x18, 0x0f, 0x24, 0x24, 0x34, 0x30, 0xfe, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0xff, 0x7e, 0x66, 0x5a, 0x5a, 0x5a, 0x66, 0x7e,
+  0x42, 0xff, 0x7a, 0x76, 0x6e, 0x42, 0x7e, 0x7e, 0x7e, 0x7e, 0x1f, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0xf8, 0x18, 0x24, 0x24, 0x24, 0x18, 0xde, 0x3c,
+  0x14, 0x14, 0x04, 0x3c, 0x14, 0x03, 0x14, 0x04, 0xbe, 0x18, 0x24, 0x24,
+  0x24, 0x18, 0x3c, 0x0f, 0x04, 0x08, 0x10, 0x3c, 0xe0, 0x7e, 0x7e, 0x7e,
+  0xff, 0x7e, 0x7e, 0x7e, 0x66, 0x5a, 0x5a, 0x5a, 0x66, 0xff, 0x7e, 0x42,
+  0x6a, 0x6a, 0x7a, 0x7e, 0x42, 0x6a, 0x7f, 0x6a, 0x7a, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0xfe, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x7f, 0x24,
+  0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0xdf, 0x7e, 0x0a, 0x0a, 0x0a, 0x74,
+  0x7c, 0x0a, 0xf7, 0x0a, 0x0a, 0x7c, 0x7e, 0x42, 0x42, 0x42, 0xf5, 0x3c,
+  0x7e, 0x3c, 0x42, 0x42, 0x42, 0xfd, 0x3c, 0x24, 0x24, 0x24, 0x24, 0x24,
+  0x24, 0xff, 0x40, 0x30, 0x18, 0x08, 0x0c, 0x04, 0x04, 0x04, 0xff, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x0c, 0x18, 0x60, 0xff, 0x01, 0x06, 0x0c, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0xff, 0x08, 0x08, 0x08, 0x0c, 0x04, 0x06, 0x02, 0x01, 0x7e, 0x04,
+  0x04, 0x3c, 0x3c, 0x04, 0x04, 0xff, 0x3c, 0x42, 0xe1, 0xf1, 0xf9, 0xfd,
+  0x7e, 0x3c, 0xff, 0x3c, 0x42, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xf7,
+  0x81, 0x81, 0x81, 0x44, 0x4e, 0x4a, 0x4a, 0xf7, 0x4a, 0x7a, 0x30, 0x7e,
+  0x7e, 0x4a, 0x4a, 0xf7, 0x4a, 0x42, 0x42, 0x7e, 0x7e, 0x0c, 0x18, 0xf7,
+  0x30, 0x7e, 0x7e, 0x7e, 0x7e, 0x42, 0x42, 0xf7, 0x42, 0x7e, 0x3c, 0x81,
+  0x81, 0x81, 0x81, 0xff, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3c,
+  0xff, 0x3c, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xbb, 0xb1, 0xb5, 0xb5, 0xff, 0xb5, 0x85, 0xcf, 0xff, 0x81,
+  0x81, 0xb5, 0xb5, 0xff, 0xb5, 0xbd, 0xbd, 0xff, 0x81, 0x81, 0xf3, 0xe7,
+  0xff, 0xcf, 0x81, 0x81, 0xff, 0x81, 0x81, 0xbd, 0xbd, 0xff, 0xbd, 0x81,
+  0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x7e, 0x3c, 0xbf, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x7e, 0xdf,
+  0x04, 0x08, 0x10, 0x20, 0x7e, 0x7c, 0x0a, 0xf7, 0x0a, 0x0a, 0x7c, 0x7e,
+  0x04, 0x08, 0x10, 0xf7, 0x08, 0x04, 0x7e, 0x7e, 0x4a, 0x4a, 0x4a, 0xfd,
+  0x42, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0xfc, 0x7e, 0x04, 0x08, 0x10,
+  0x08, 0x04, 0x7d, 0x7e, 0x7e, 0x4a, 0x4a, 0x4a, 0x42, 0xbf, 0x44, 0x4a,
+  0x4a, 0x4a, 0x4a, 0x30, 0x44, 0xdf, 0x4a, 0x4a, 0x4a, 0x4a, 0x30, 0x7c,
+  0x0a, 0xf7, 0x0a, 0x0a, 0x7c, 0x3c, 0x42, 0x52, 0x52, 0x7d, 0x72, 0x7e,
+  0x4a, 0x4a, 0x42, 0x42, 0x3f, 0x44, 0x4a, 0x4a, 0x4a, 0x4a, 0x30, 0xff,
+  0x30, 0x38, 0x3c, 0x3e, 0x3e, 0x3c, 0x38, 0x30, 0xbe, 0x24, 0x2a, 0x2a,
+  0x2a, 0x12, 0x24, 0xef, 0x2a, 0x2a, 0x2a, 0x12, 0x3e, 0x22, 0x22, 0xdb,
+  0x22, 0x1c, 0x02, 0x3e, 0x22, 0x2a, 0xf7, 0x2a, 0x2a, 0x14, 0x1c, 0x22,
+  0x22, 0x22, 0x7d, 0x1c, 0x1c, 0x2a, 0x2a, 0x2a, 0x10, 0x80, 0x24, 0xef,
+  0x2a, 0x2a, 0x2a, 0x12, 0x22, 0x14, 0x08, 0xdb, 0x14, 0x22, 0x02, 0x3e,
+  0x32, 0x2a, 0xf7, 0x2a, 0x2a, 0x24, 0x14, 0x2a, 0x2a, 0x2a, 0x7d, 0x14,
+  0x1c, 0x22, 0x22, 0x22, 0x1c, 0xc0, 0x3e, 0x2a, 0x7d, 0x5c, 0x32, 0x2a,
+  0x2a, 0x2a, 0x24, 0xdf, 0x18, 0x14, 0x12, 0x3e, 0x10, 0x32, 0x2a, 0xf7,
+  0x2a, 0x2a, 0x24, 0x04, 0x2a, 0x2a, 0x2a, 0x7d, 0x1c, 0x2e, 0x2a, 0x2a,
+  0x2a, 0x12, 0xf8, 0x3e, 0x0a, 0x0a, 0x0a, 0x02, 0xbe, 0x02, 0x02, 0x3e,
+  0x02, 0x02, 0x32, 0xef, 0x2a, 0x2a, 0x2a, 0x24, 0x2e, 0x2a, 0x2a, 0xfb,
+  0x2a, 0x12, 0x3e, 0x08, 0x08, 0x08, 0x3e, 0xf6, 0x02, 0x3e, 0x1c, 0x2a,
+  0x2a, 0x2a, 0x7d, 0x10, 0x24, 0x2a, 0x2a, 0x2a, 0x12, 0xef, 0x24, 0x24,
+  0x24, 0x24, 0x44, 0x4a, 0x4a, 0xff, 0x4a, 0x4a, 0x30, 0x02, 0x02, 0x7e,
+  0x02, 0x02, 0xbe, 0x7c, 0x0a, 0x0a, 0x0a, 0x7c, 0x02, 0xef, 0x02, 0x7e,
+  0x02, 0x02, 0x44, 0x4a, 0x4a, 0xf7, 0x4a, 0x4a, 0x30, 0x24, 0x24, 0x24,
+  0x24, 0x7d, 0x24, 0x7e, 0x08, 0x08, 0x08, 0x7e, 0x7d, 0x7e, 0x44, 0x4a,
+  0x4a, 0x4a, 0x30, 0xdf, 0x02, 0x02, 0x7e, 0x02, 0x02, 0x3c, 0x42, 0xf7,
+  0x42, 0x42, 0x3c, 0x7e, 0x0a, 0x0a, 0x0a, 0x7d, 0x74, 0x02, 0x04, 0x78,
+  0x04, 0x02, 0xf8, 0x3c, 0xfe, 0xfe, 0xfe, 0xfe, 0x01, 0x3c, 0x7c, 0x5c,
+  0x7e, 0x7e, 0x3e, 0x1c, 0x1f, 0x5c, 0x7e, 0x7e, 0x3e, 0x1c, 0xfc, 0x70,
+  0x70, 0xfc, 0xfc, 0xfc, 0x70, 0x3f, 0x70, 0xfc, 0xfc, 0xfc, 0x70, 0x70,
+  0xfc, 0xf0, 0xf8, 0xf8, 0x98, 0x9e, 0x9e, 0x1f, 0x9e, 0x98, 0x98, 0x98,
+  0x18, 0xfc, 0x30, 0x78, 0x78, 0x30, 0x80, 0xc0, 0x3f, 0xe0, 0xf0, 0x78,
+  0x3c, 0x1c, 0x0c, 0xfc, 0x70, 0xf8, 0xf8, 0x98, 0x9e, 0x9e, 0xf0, 0xfc,
+  0xfe, 0xfe, 0x06, 0x03, 0x02, 0x02, 0xf0, 0x02, 0x02, 0x06, 0xfe, 0x03,
+  0xfe, 0xfc, 0xfc, 0x80, 0x98, 0xf8, 0xf0, 0xf0, 0xfc, 0x3f, 0xfc, 0xf0,
+  0xf0, 0xf8, 0x98, 0x80, 0xf8, 0x80, 0x80, 0x80, 0x80, 0xf8, 0x1f, 0xf8,
+  0x80, 0x80, 0x80, 0x80, 0xf8, 0x80, 0x80, 0x80, 0x80, 0x80, 0x1f, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0xfc, 0xf8, 0xfc, 0xfe, 0x0e, 0xc6, 0xc6, 0x1f,
+  0xc6, 0x0e, 0xfe, 0xfc, 0xf8, 0xf0, 0x18, 0x1c, 0xfe, 0xfe, 0x01, 0xfe,
+  0xfc, 0x06, 0x86, 0xc6, 0xc6, 0xc6, 0xc6, 0x1f, 0xc6, 0xee, 0xfe, 0x7c,
+  0x38, 0xf8, 0x06, 0xc6, 0xc6, 0xc6, 0xc6, 0x1f, 0xc6, 0xee, 0xfe, 0xfc,
+  0x38, 0xf8, 0x80, 0xc0, 0xe0, 0xf0, 0x78, 0x0f, 0x3c, 0xfe, 0xfe, 0xfe,
+  0xfc, 0xfe, 0xfe, 0xfe, 0xc6, 0xc6, 0xc6, 0x0f, 0xc6, 0xc6, 0xc6, 0x86,
+  0xfc, 0xf8, 0xfc, 0xfe, 0xce, 0xc6, 0xc6, 0xfc, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x86, 0x1f, 0xc6, 0xe6, 0xfe, 0x7e, 0x3e, 0xfc, 0x38, 0xfc, 0xfe,
+  0xee, 0xc6, 0xc6, 0xfc, 0x78, 0xfc, 0xfe, 0xce, 0x86, 0x86, 0x1f, 0x86,
+  0x8e, 0xfe, 0xfc, 0xf8, 0xf8, 0x38, 0x7c, 0x7c, 0x7c, 0x38, 0x1f, 0x3c,
+  0x1e, 0x0e, 0x06, 0x02, 0xf8, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1f, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0xf8, 0x02, 0x06, 0x0e, 0x1e, 0x3c, 0x1f, 0x78,
+  0xf0, 0xe0, 0xc0, 0x80, 0xfc, 0x38, 0x3c, 0x3e, 0x0e, 0x06, 0x86, 0x1f,
+  0x86, 0xce, 0xfe, 0xfc, 0x78, 0xfc, 0xfc, 0xfe, 0xff, 0x17, 0x17, 0xff,
+  0x3f, 0xff, 0x17, 0x17, 0xff, 0xfe, 0xfc, 0xfc, 0xf0, 0xf8, 0xfc, 0xce,
+  0xc6, 0xc6, 0x1f, 0xc6, 0xce, 0xfc, 0xf8, 0xf0, 0xfc, 0xf8, 0xfc, 0xfe,
+  0x0e, 0x06, 0x06, 0x1f, 0x06, 0x06, 0x0e, 0x0e, 0x0c, 0xfc, 0xfe, 0xfe,
+  0xfe, 0x06, 0x06, 0x06, 0x1f, 0x06, 0x0e, 0xfe, 0xfc, 0xf8, 0x1f, 0xc6,
+  0xc6, 0x06, 0x06, 0x06, 0xfc, 0xf8, 0xfc, 0xfe, 0x0e, 0x06, 0xc6, 0x1f,
+  0xc6, 0xc6, 0xce, 0xce, 0xcc, 0xfc, 0xfe, 0xfe, 0xfe, 0xc0, 0xc0, 0xc0,
+  0x1f, 0xc0, 0xc0, 0xfe, 0xfe, 0xfe, 0xe0, 0x06, 0xfe, 0xfe, 0x03, 0xfe,
+  0x06, 0x1c, 0xfe, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfe, 0xc0, 0xc0, 0xe0,
+  0x1f, 0xf0, 0xf8, 0x3e, 0x1e, 0x0e, 0xfc, 0xfe, 0xfe, 0xfc, 0x38, 0x70,
+  0xe0, 0x1f, 0x70, 0x38, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0x78,
+  0xf0, 0xe0, 0x1f, 0xc0, 0x80, 0xfe, 0xfe, 0xfe, 0xfc, 0x38, 0x7c, 0xfe,
+  0xee, 0xc6, 0xc6, 0xfc, 0x06, 0x06, 0x06, 0x06, 0xfe, 0xfe, 0x1f, 0xfe,
+  0x06, 0x06, 0x06, 0x06, 0x3c, 0x3e, 0xfe, 0xfe, 0xc0, 0x1e, 0xc0, 0xfe,
+  0xfe, 0x3e, 0x9c, 0xfe, 0xfe, 0xfe, 0x80, 0xfc, 0x1e, 0x3e, 0x7e, 0xf0,
+  0xe0, 0xc0, 0x1f, 0xe0, 0xf0, 0x7e, 0x3e, 0x1e, 0xfc, 0x3e, 0x7e, 0xfe,
+  0xe0, 0xc0, 0x80, 0x1f, 0xc0, 0xe0, 0xfe, 0x7e, 0x3e, 0xfc, 0x06, 0x06,
+  0x06, 0x86, 0xc6, 0xe6, 0x1f, 0xf6, 0x7e, 0x3e, 0x1e, 0x0e, 0xf0, 0xfe,
+  0xfe, 0xfe, 0x06, 0x03, 0x06, 0x06, 0xfe, 0x0c, 0x1c, 0x3c, 0x78, 0xf0,
+  0xe0, 0xc0, 0x01, 0x80, 0xf0, 0x06, 0x06, 0x06, 0xfe, 0x03, 0xfe, 0xfe,
+  0xfe, 0x80, 0xc0, 0xe0, 0xf0, 0x78, 0x3c, 0x1e, 0x7f, 0x1e, 0x3c, 0x78,
+  0xf0, 0xe0, 0xc0, 0x80, 0xcc, 0x08, 0x08, 0x08, 0x08, 0xf8, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0xc7, 0x18, 0x18, 0x18, 0x18, 0x3c, 0xe3, 0x3c, 0x18, 0x18, 0x18, 0x18,
+  0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x08, 0x08, 0x1f, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x33, 0x08, 0x08, 0x08, 0x08, 0x7f, 0x1c, 0x22, 0x41,
+  0x41, 0x41, 0x22, 0x1c, 0x7f, 0x1c, 0x22, 0x5d, 0x5d, 0x5d, 0x22, 0x1c,
+  0xf0, 0x18, 0x3d, 0x3d, 0x18, 0xfc, 0x0e, 0x0e, 0x3f, 0x3f, 0x3f, 0x0e,
+  0x3f, 0x0e, 0x3f, 0x3f, 0x3f, 0x0e, 0x0e, 0xfc, 0x18, 0x19, 0x19, 0x19,
+  0x79, 0x79, 0x1f, 0x79, 0x19, 0x1f, 0x1f, 0x0f, 0xfe, 0x30, 0x38, 0x3c,
+  0x1e, 0x0f, 0x07, 0x03, 0x1f, 0x01, 0x0c, 0x1e, 0x1e, 0x0c, 0xfc, 0x0f,
+  0x1f, 0x1f, 0x19, 0x79, 0x79, 0x1f, 0x79, 0x19, 0x19, 0x19, 0x18, 0xf0,
+  0x1f, 0x3f, 0x3f, 0x30, 0x03, 0x20, 0x20, 0xf0, 0x20, 0x20, 0x30, 0x3f,
+  0x03, 0x3f, 0x1f, 0xfc, 0x01, 0x19, 0x1f, 0x0f, 0x0f, 0x3f, 0x3f, 0x3f,
+  0x0f, 0x0f, 0x1f, 0x19, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x1f,
+  0x1f, 0x01, 0x01, 0x01, 0x01, 0x7c, 0x38, 0x7c, 0x7c, 0x7c, 0x38, 0xf8,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7c,
+  0x1c, 0x3e, 0x3e, 0x3e, 0x1c, 0x01, 0x01, 0xfc, 0x0f, 0x1f, 0x3f, 0x38,
+  0x31, 0x31, 0x1f, 0x31, 0x38, 0x3f, 0x1f, 0x0f, 0xf0, 0x30, 0x30, 0x3f,
+  0x3f, 0x07, 0x3f, 0x30, 0x30, 0xfc, 0x3f, 0x3f, 0x3f, 0x31, 0x30, 0x30,
+  0x1f, 0x30, 0x30, 0x30, 0x30, 0x30, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x1f, 0x30, 0x39, 0x3f, 0x1f, 0x0f, 0xfc, 0x0f, 0x0f, 0x0f, 0x0d,
+  0x0c, 0x0c, 0x1f, 0x0c, 0x3f, 0x3f, 0x3f, 0x0c, 0xfc, 0x0f, 0x1f, 0x3f,
+  0x38, 0x30, 0x30, 0xc0, 0x3f, 0x3f, 0x03, 0x3f, 0x01, 0xfc, 0x0f, 0x1f,
+  0x3f, 0x39, 0x30, 0x30, 0xf8, 0x30, 0x31, 0x31, 0x31, 0x31, 0x1f, 0x31,
+  0x39, 0x3f, 0x1f, 0x0f, 0xf8, 0x1c, 0x3e, 0x3e, 0x3e, 0x1c, 0xf8, 0x5c,
+  0x7e, 0x7e, 0x3e, 0x1c, 0xf0, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x1e, 0x3c,
+  0x38, 0x30, 0x20, 0xf8, 0x06, 0x06, 0x06, 0x06, 0x06, 0x1f, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0xf8, 0x20, 0x30, 0x38, 0x3c, 0x1e, 0x0f, 0x0f, 0x07,
+  0x03, 0x01, 0xc0, 0x37, 0x37, 0x07, 0x37, 0x01, 0x01, 0xfc, 0x1f, 0x3f,
+  0x7f, 0x7f, 0x77, 0x77, 0x3f, 0x77, 0x77, 0x7f, 0x7f, 0x3f, 0x1f, 0x1c,
+  0x3f, 0x3f, 0x3f, 0xfc, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x1f, 0x30,
+  0x30, 0x38, 0x38, 0x18, 0x1f, 0x30, 0x38, 0x3f, 0x1f, 0x0f, 0x1f, 0x30,
+  0x30, 0x3f, 0x3f, 0x1f, 0xe0, 0x30, 0x3f, 0x3f, 0x03, 0x3f, 0x30, 0xfc,
+  0x0e, 0x1e, 0x3e, 0x38, 0x30, 0x30, 0x9c, 0x3f, 0x3f, 0x3f, 0x01, 0x1f,
+  0x03, 0x07, 0x3f, 0x3e, 0x3c, 0x1f, 0x03, 0x07, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x36, 0x3e, 0x3f, 0x1f, 0x3f, 0x38, 0x1f, 0x01, 0x03, 0x3f, 0x3f, 0x3e,
+  0x01, 0x3f, 0xf0, 0x03, 0x0f, 0x3f, 0x3c, 0x07, 0x3f, 0x0f, 0x03, 0xfc,
+  0x3f, 0x3f, 0x1f, 0x0e, 0x07, 0x03, 0x1f, 0x07, 0x0e, 0x1f, 0x3f, 0x3f,
+  0xfc, 0x3c, 0x3e, 0x3f, 0x07, 0x03, 0x01, 0xe0, 0x01, 0x3f, 0x3f, 0xfc,
+  0x3c, 0x3e, 0x3f, 0x37, 0x33, 0x31, 0xf0, 0x3f, 0x3f, 0x3f, 0x30, 0x03,
+  0x30, 0x30, 0xc0, 0x01, 0x03, 0x3f, 0x07, 0x0f, 0x1e, 0x3c, 0x38, 0x30,
+  0xf0, 0x30, 0x30, 0x30, 0x3f, 0x03, 0x3f, 0x3f, 0x0e, 0x01, 0x01, 0x01,
+  0x70, 0x01, 0x01, 0x01, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0,
 };
-unsigned int duck_font_raw_len = 8192;
+
+#endif  // #ifdef ENABLE_ASSET_STORE
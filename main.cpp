@@ -11,9 +11,11 @@
 #include "printf.h"
 #include "usbd_rom_api.h"
 
-#include "duck_font.h"
-
 //#define ENABLE_USB_MSC
+//#define ENABLE_PROFILER
+//#define ENABLE_TRACE
+//#define ENABLE_ASSET_STORE
+//#define ENABLE_I2C_CAPTURE
 
 #ifdef ENABLE_USB_MSC
 
@@ -786,6 +788,15 @@ template<class T> const T& constrain(const T& x, const T &a, const T &b) { retur
 
 static volatile uint32_t system_clock_ms = 0;
 
+// Set by whatever changes state shown on the display, the next UI::Update()
+// redraws the current screen once and clears them.
+#define UI_INVALID_MODE		0x01
+#define UI_INVALID_SETTINGS	0x02
+#define UI_INVALID_BATTERY	0x04
+#define UI_INVALID_RADIO	0x08
+#define UI_INVALID_CLOCK	0x10
+static volatile uint32_t ui_invalid = UI_INVALID_MODE;
+
 #include "duck_font.h"
 
 struct rgba {
@@ -850,25 +861,13 @@ private:
 	uint32_t rgbp;
 };
 
-static const uint8_t rev_bits[] = 
-{
-  0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0, 
-  0x08, 0x88, 0x48, 0xC8, 0x28, 0xA8, 0x68, 0xE8, 0x18, 0x98, 0x58, 0xD8, 0x38, 0xB8, 0x78, 0xF8, 
-  0x04, 0x84, 0x44, 0xC4, 0x24, 0xA4, 0x64, 0xE4, 0x14, 0x94, 0x54, 0xD4, 0x34, 0xB4, 0x74, 0xF4, 
-  0x0C, 0x8C, 0x4C, 0xCC, 0x2C, 0xAC, 0x6C, 0xEC, 0x1C, 0x9C, 0x5C, 0xDC, 0x3C, 0xBC, 0x7C, 0xFC, 
-  0x02, 0x82, 0x42, 0xC2, 0x22, 0xA2, 0x62, 0xE2, 0x12, 0x92, 0x52, 0xD2, 0x32, 0xB2, 0x72, 0xF2, 
-  0x0A, 0x8A, 0x4A, 0xCA, 0x2A, 0xAA, 0x6A, 0xEA, 0x1A, 0x9A, 0x5A, 0xDA, 0x3A, 0xBA, 0x7A, 0xFA,
-  0x06, 0x86, 0x46, 0xC6, 0x26, 0xA6, 0x66, 0xE6, 0x16, 0x96, 0x56, 0xD6, 0x36, 0xB6, 0x76, 0xF6, 
-  0x0E, 0x8E, 0x4E, 0xCE, 0x2E, 0xAE, 0x6E, 0xEE, 0x1E, 0x9E, 0x5E, 0xDE, 0x3E, 0xBE, 0x7E, 0xFE,
-  0x01, 0x81, 0x41, 0xC1, 0x21, 0xA1, 0x61, 0xE1, 0x11, 0x91, 0x51, 0xD1, 0x31, 0xB1, 0x71, 0xF1,
-  0x09, 0x89, 0x49, 0xC9, 0x29, 0xA9, 0x69, 0xE9, 0x19, 0x99, 0x59, 0xD9, 0x39, 0xB9, 0x79, 0xF9, 
-  0x05, 0x85, 0x45, 0xC5, 0x25, 0xA5, 0x65, 0xE5, 0x15, 0x95, 0x55, 0xD5, 0x35, 0xB5, 0x75, 0xF5,
-  0x0D, 0x8D, 0x4D, 0xCD, 0x2D, 0xAD, 0x6D, 0xED, 0x1D, 0x9D, 0x5D, 0xDD, 0x3D, 0xBD, 0x7D, 0xFD,
-  0x03, 0x83, 0x43, 0xC3, 0x23, 0xA3, 0x63, 0xE3, 0x13, 0x93, 0x53, 0xD3, 0x33, 0xB3, 0x73, 0xF3, 
-  0x0B, 0x8B, 0x4B, 0xCB, 0x2B, 0xAB, 0x6B, 0xEB, 0x1B, 0x9B, 0x5B, 0xDB, 0x3B, 0xBB, 0x7B, 0xFB,
-  0x07, 0x87, 0x47, 0xC7, 0x27, 0xA7, 0x67, 0xE7, 0x17, 0x97, 0x57, 0xD7, 0x37, 0xB7, 0x77, 0xF7, 
-  0x0F, 0x8F, 0x4F, 0xCF, 0x2F, 0xAF, 0x6F, 0xEF, 0x1F, 0x9F, 0x5F, 0xDF, 0x3F, 0xBF, 0x7F, 0xFF
-};
+// Reverses the bits of each byte in a word, 4 column bytes at a time
+static inline uint32_t rev_bits(uint32_t x) {
+	x = ((x >> 1) & 0x55555555UL) | ((x & 0x55555555UL) << 1);
+	x = ((x >> 2) & 0x33333333UL) | ((x & 0x33333333UL) << 2);
+	x = ((x >> 4) & 0x0F0F0F0FUL) | ((x & 0x0F0F0F0FUL) << 4);
+	return x;
+}
 
 static const uint32_t radio_colors[] = {
 	0x808080UL,
@@ -885,14 +884,202 @@ static const uint32_t radio_colors[] = {
 };
 
 
+// Called once per ms from delay() if set, used to keep the boot
+// splash animating while blocking peripheral init is in progress.
+static void (*delay_yield)() = 0;
+
 static void delay(uint32_t ms) {
     for (volatile uint32_t j = 0; j < ms; j++) {
         Chip_WWDT_Feed(LPC_WWDT);
+        if (delay_yield) {
+            delay_yield();
+        }
         for (volatile uint32_t i = 0; i < 3000; i++) {
         }
     }
 }
 
+// Time since Setup::InitTimer() in us, TIMER32_0 counts ms and
+// its prescale counter gives us the fraction.
+static uint32_t micros() {
+	uint32_t ms = Chip_TIMER_ReadCount(LPC_TIMER32_0);
+	uint32_t pc = LPC_TIMER32_0->PC;
+	if (Chip_TIMER_ReadCount(LPC_TIMER32_0) != ms) {
+		ms++;
+		pc = 0;
+	}
+	return ms * 1000 + (pc * 1000) / (LPC_TIMER32_0->PR + 1);
+}
+
+class Trace {
+
+	#define TRACE_RECORDS 128
+	// Masked events are still recorded when they take at least this long
+	#define TRACE_SLOW_US 250
+
+public:
+	// Keep in sync with tools/trace.cpp
+	enum Event {
+		SYSTICK = 0,
+		FRAME,
+		LED_PUSH,
+		I2C,
+		DISPLAY,
+		RADIO_IRQ,
+		RADIO_PROCESS,
+		RX_DONE,
+		RECORD_MESSAGE,
+		EEPROM_SAVE,
+		FLASH_WRITE,
+		FLASH_ERASE,
+		INPUT
+	};
+
+	static void Begin(Event event, uint16_t arg = 0) {
+		Record(event, 'B', arg);
+	}
+
+	static void End(Event event, uint16_t arg = 0) {
+		Record(event, 'E', arg);
+	}
+
+	static void Instant(Event event, uint16_t arg = 0) {
+		Record(event, 'i', arg);
+	}
+
+	static uint32_t Start() {
+#ifdef ENABLE_TRACE
+		return micros();
+#else  // #ifdef ENABLE_TRACE
+		return 0;
+#endif  // #ifdef ENABLE_TRACE
+	}
+
+	// One record for a whole span since Start(), arg is the duration in us.
+	// Used for the events which happen every ms and would flush the buffer
+	// otherwise.
+	static void Complete(Event event, uint32_t start_us) {
+#ifdef ENABLE_TRACE
+		uint32_t duration = micros() - start_us;
+		if ((mask & (1UL << event)) == 0 && duration < TRACE_SLOW_US) {
+			return;
+		}
+		Store(event, 'X', start_us, duration > 0xFFFF ? 0xFFFF : duration);
+#else  // #ifdef ENABLE_TRACE
+		(void)event; (void)start_us;
+#endif  // #ifdef ENABLE_TRACE
+	}
+
+	static void SetMask(uint32_t _mask) {
+#ifdef ENABLE_TRACE
+		mask = _mask;
+#else  // #ifdef ENABLE_TRACE
+		(void)_mask;
+#endif  // #ifdef ENABLE_TRACE
+	}
+
+	static void Clear() {
+#ifdef ENABLE_TRACE
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		head = 0;
+		count = 0;
+		__set_PRIMASK(primask);
+#endif  // #ifdef ENABLE_TRACE
+	}
+
+	// '@TRACE DUMP' a line at a time, see UART::StartDump(). The ring is
+	// frozen from the first line to the last.
+	static bool DumpLine(uint32_t &cursor, char *str) {
+#ifdef ENABLE_TRACE
+		if (cursor == 0) {
+			uint32_t primask = __get_PRIMASK();
+			__disable_irq();
+			dump_count = count < TRACE_RECORDS ? count : TRACE_RECORDS;
+			dump_start = (head + TRACE_RECORDS - dump_count) % TRACE_RECORDS;
+			// Freeze so the dump itself does not overwrite what we are reading
+			frozen = true;
+			__set_PRIMASK(primask);
+			sprintf(str,"TRACE %d %d\r\n", dump_count, count - dump_count);
+		} else if (cursor <= dump_count) {
+			const entry &e = entries[(dump_start + cursor - 1) % TRACE_RECORDS];
+			sprintf(str,"T %08x %02x %c %04x\r\n", e.time, e.event, e.phase, e.arg);
+		} else if (cursor == dump_count + 1) {
+			strcpy(str,"TRACE END\r\n");
+			frozen = false;
+		} else {
+			return false;
+		}
+#else  // #ifdef ENABLE_TRACE
+		if (cursor != 0) {
+			return false;
+		}
+		strcpy(str,"TRACE DISABLED\r\n");
+#endif  // #ifdef ENABLE_TRACE
+		cursor++;
+		return true;
+	}
+
+private:
+
+	static void Record(Event event, uint8_t phase, uint16_t arg) {
+#ifdef ENABLE_TRACE
+		if ((mask & (1UL << event)) == 0) {
+			return;
+		}
+		Store(event, phase, micros(), arg);
+#else  // #ifdef ENABLE_TRACE
+		(void)event; (void)phase; (void)arg;
+#endif  // #ifdef ENABLE_TRACE
+	}
+
+#ifdef ENABLE_TRACE
+	static void Store(Event event, uint8_t phase, uint32_t time, uint16_t arg) {
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		// Slow spans bypass the mask, so the freeze needs its own flag
+		if (frozen) {
+			__set_PRIMASK(primask);
+			return;
+		}
+		entry &e = entries[head];
+		e.time = time;
+		e.event = event;
+		e.phase = phase;
+		e.arg = arg;
+		head = (head + 1) % TRACE_RECORDS;
+		count++;
+		__set_PRIMASK(primask);
+	}
+
+	struct entry {
+		uint32_t time;
+		uint8_t event;
+		uint8_t phase;
+		uint16_t arg;
+	};
+
+	static entry entries[TRACE_RECORDS];
+	static uint32_t head;
+	static uint32_t count;
+	static uint32_t mask;
+	static uint32_t dump_start;
+	static uint32_t dump_count;
+	static bool frozen;
+#endif  // #ifdef ENABLE_TRACE
+};
+
+#ifdef ENABLE_TRACE
+Trace::entry Trace::entries[TRACE_RECORDS];
+uint32_t Trace::head = 0;
+uint32_t Trace::count = 0;
+uint32_t Trace::dump_start = 0;
+uint32_t Trace::dump_count = 0;
+bool Trace::frozen = false;
+// SysTick and LED pushes happen every ms, only record them when slow
+uint32_t Trace::mask = ~((1U << Trace::SYSTICK) | (1U << Trace::LED_PUSH));
+#endif  // #ifdef ENABLE_TRACE
+
 class Random {
 public:
 	Random(uint32_t seed) {
@@ -925,27 +1112,462 @@ private:
 
 };
 
-class I2C_Guard {
+// Interrupt driven I2C0 master. Display writes are copied into a pool and
+// sent in the background, register accesses to the charger jump the queue
+// and wait for their result.
+class I2CBus {
+
+	#define I2C_QUEUE_SIZE 10
+	#define I2C_POOL_SIZE 320
+	#define I2C_URGENT_SIZE 4
+	#define I2C_TIMEOUT_MS 10
+#ifdef ENABLE_I2C_CAPTURE
+	#define I2C_CAPTURE_SIZE 1024
+	#define I2C_CAPTURE_LINE 20
+#endif  // #ifdef ENABLE_I2C_CAPTURE
+
+	const uint32_t I2C_SCL_PIN = 0x0004; // 0_4
+	const uint32_t I2C_SDA_PIN = 0x0005; // 0_5
+
 public:
-	static volatile uint32_t i2c_guard;
-	
-	I2C_Guard() {
-		i2c_guard++;
+
+	I2CBus() {
+		current = 0;
+		current_urgent = false;
+		current_start = 0;
+		queue_head = 0;
+		queue_tail = 0;
+		queue_count = 0;
+		pool_head = 0;
+		pool_tail = 0;
+		urgent_count = 0;
+		speed = 0;
+		pin_func = 0;
+		transactions = 0;
+		errors = 0;
+		timeouts = 0;
+		dropped = 0;
+#ifdef ENABLE_I2C_CAPTURE
+		capture_len = 0;
+		capturing = false;
+		capture_full = false;
+		capture_frame = false;
+		dump_limit = 0;
+		dump_pos = 0;
+		dump_end = 0;
+#endif  // #ifdef ENABLE_I2C_CAPTURE
+	}
+
+	void Init(uint32_t _speed, uint32_t _pin_func) {
+		speed = _speed;
+		pin_func = _pin_func;
+		Chip_I2C_Init(I2C0);
+		Chip_I2C_SetClockRate(I2C0, speed);
+		// Above SysTick so a blocking Transfer() from there can complete
+		NVIC_SetPriority(I2C0_IRQn, 1);
+		NVIC_ClearPendingIRQ(I2C0_IRQn);
+		NVIC_EnableIRQ(I2C0_IRQn);
+	}
+
+	// Queue a write and return without waiting. Fails if the queue or
+	// the data pool is full, the caller can try again later.
+	bool Write(uint8_t addr, const uint8_t *buf, uint32_t len) {
+		return Write(addr, buf, len, 0, 0);
+	}
+
+	// Command followed by data, both are queued or neither is. The data
+	// transfer is started from the interrupt right after the command.
+	bool Write(uint8_t addr, const uint8_t *cmd, uint32_t cmd_len, const uint8_t *data, uint32_t data_len) {
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		uint32_t needed = data ? 2 : 1;
+		uint8_t *cmd_dst = 0;
+		uint8_t *data_dst = 0;
+		if ((queue_count + needed) > I2C_QUEUE_SIZE ||
+			!Alloc(cmd_len, data_len, &cmd_dst, &data_dst)) {
+			dropped++;
+			__set_PRIMASK(primask);
+			return false;
+		}
+		memcpy(cmd_dst, cmd, cmd_len);
+		Push(addr, cmd_dst, cmd_len);
+		Capture(addr, cmd, cmd_len);
+		if (data) {
+			memcpy(data_dst, data, data_len);
+			Push(addr, data_dst, data_len);
+			Capture(addr, data, data_len);
+		}
+		if (!current) {
+			StartNext();
+		}
+		__set_PRIMASK(primask);
+		return true;
 	}
-	
-	~I2C_Guard() {
-		i2c_guard--;
+
+	// Blocking write which never gets dropped, for panel setup.
+	void WriteWait(uint8_t addr, const uint8_t *buf, uint32_t len) {
+		while (!Write(addr, buf, len)) {
+			CheckTimeout();
+		}
 	}
-	
-	bool Check() {
-		if (i2c_guard > 0) {
+
+	// Write and/or read with a repeated start, served before anything
+	// already queued. Waits for the result.
+	bool Transfer(uint8_t addr, const uint8_t *tx, uint32_t tx_len, uint8_t *rx, uint32_t rx_len) {
+		I2CM_XFER_T xfer;
+		xfer.slaveAddr = addr;
+		xfer.options = 0;
+		xfer.status = I2CM_STATUS_BUSY;
+		xfer.txSz = tx_len;
+		xfer.rxSz = rx_len;
+		xfer.txBuff = tx;
+		xfer.rxBuff = rx;
+
+		for (;;) {
+			uint32_t primask = __get_PRIMASK();
+			__disable_irq();
+			if (urgent_count < I2C_URGENT_SIZE) {
+				urgent[urgent_count++] = &xfer;
+				if (!current) {
+					StartNext();
+				}
+				__set_PRIMASK(primask);
+				break;
+			}
+			__set_PRIMASK(primask);
+			CheckTimeout();
+		}
+
+		volatile uint16_t *status = &xfer.status;
+		while (*status == I2CM_STATUS_BUSY) {
+			CheckTimeout();
+		}
+		return *status == I2CM_STATUS_OK;
+	}
+
+	bool Idle() const {
+		return current == 0;
+	}
+
+	// Whether count writes of len bytes in total would be queued right
+	// now. Only the interrupt runs besides the writer and it only frees
+	// space, so a yes holds until the writes are made.
+	bool Fits(uint32_t count, uint32_t len) {
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		uint32_t head = 0;
+		bool fits = (queue_count + count) <= I2C_QUEUE_SIZE && Room(len, &head);
+		__set_PRIMASK(primask);
+		return fits;
+	}
+
+	// '@I2C CAPTURE' records every queued write from here on until the
+	// buffer is full, CaptureFrame() separates the frames. Each '@I2C DUMP'
+	// hands back what it printed, so one capture can span many dumps
+	// without a gap. Feeds tools/oled without a logic analyzer, but it
+	// shows what was queued, not what made it onto the wire: errors and
+	// timeouts are in the '@I2C' counters.
+	void StartCapture() {
+#ifdef ENABLE_I2C_CAPTURE
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		capture_len = 0;
+		capture_full = false;
+		capture_frame = false;
+		capturing = true;
+		__set_PRIMASK(primask);
+#endif  // #ifdef ENABLE_I2C_CAPTURE
+	}
+
+	void CaptureFrame() {
+#ifdef ENABLE_I2C_CAPTURE
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		// A frame without writes needs no separator
+		if (capture_frame) {
+			Capture(0, 0, 0);
+		}
+		__set_PRIMASK(primask);
+#endif  // #ifdef ENABLE_I2C_CAPTURE
+	}
+
+	// '@I2C DUMP' a line at a time in the text format of tools/oled, see
+	// UART::StartDump(). Writes longer than a line continue after a '\'.
+	bool CaptureLine(uint32_t &cursor, char *str) {
+#ifdef ENABLE_I2C_CAPTURE
+		if (cursor == 0) {
+			// Writes queued meanwhile go behind dump_limit
+			uint32_t primask = __get_PRIMASK();
+			__disable_irq();
+			dump_limit = capture_len;
+			__set_PRIMASK(primask);
+			dump_pos = 0;
+			dump_end = 0;
+			sprintf(str,"# I2C CAPTURE %d%s\r\n", dump_limit, capture_full ? " FULL" : "");
+			cursor++;
+			return true;
+		}
+		if (cursor != 1) {
 			return false;
 		}
-		return false;
+		if (dump_pos >= dump_end && dump_pos >= dump_limit) {
+			uint32_t primask = __get_PRIMASK();
+			__disable_irq();
+			memmove(capture, &capture[dump_limit], capture_len - dump_limit);
+			capture_len -= dump_limit;
+			__set_PRIMASK(primask);
+			strcpy(str,"# I2C END\r\n");
+			cursor++;
+			return true;
+		}
+		if (dump_pos >= dump_end) {
+			uint8_t addr = capture[dump_pos];
+			dump_end = dump_pos + 2 + capture[dump_pos + 1];
+			dump_pos += 2;
+			if (addr == 0) {
+				strcpy(str,"--\r\n");
+				return true;
+			}
+			sprintf(str,"%02x:", addr);
+		} else {
+			strcpy(str,"   ");
+		}
+		for (uint32_t c=0; c<I2C_CAPTURE_LINE && dump_pos < dump_end; c++) {
+			sprintf(str + strlen(str)," %02x", capture[dump_pos++]);
+		}
+		strcat(str, dump_pos < dump_end ? " \\\r\n" : "\r\n");
+		return true;
+#else  // #ifdef ENABLE_I2C_CAPTURE
+		if (cursor != 0) {
+			return false;
+		}
+		strcpy(str,"I2C CAPTURE DISABLED\r\n");
+		cursor++;
+		return true;
+#endif  // #ifdef ENABLE_I2C_CAPTURE
+	}
+
+	// Called from SysTick and while waiting. Recovers a bus which is
+	// stuck, e.g. a slave holding SDA low after a reset mid transfer.
+	void CheckTimeout() {
+		if (!current) {
+			return;
+		}
+		if ((Chip_TIMER_ReadCount(LPC_TIMER32_0) - current_start) < I2C_TIMEOUT_MS) {
+			return;
+		}
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		if (current) {
+			timeouts++;
+			Recover();
+			current->status = I2CM_STATUS_ERROR;
+			Finish();
+			StartNext();
+		}
+		__set_PRIMASK(primask);
+	}
+
+	void IRQHandler() {
+		if (!current) {
+			Chip_I2CM_ClearSI(LPC_I2C);
+			return;
+		}
+		if (Chip_I2CM_XferHandler(LPC_I2C, current)) {
+			if (current->status != I2CM_STATUS_OK) {
+				errors++;
+			}
+			Finish();
+			// STOP is pending, STA makes the controller send the
+			// next START right after it.
+			StartNext();
+		}
+	}
+
+	uint32_t transactions;
+	uint32_t errors;
+	uint32_t timeouts;
+	uint32_t dropped;
+
+private:
+
+	void Push(uint8_t addr, uint8_t *buf, uint32_t len) {
+		I2CM_XFER_T &xfer = queue[queue_head];
+		xfer.slaveAddr = addr;
+		xfer.options = 0;
+		xfer.status = I2CM_STATUS_BUSY;
+		xfer.txSz = len;
+		xfer.rxSz = 0;
+		xfer.txBuff = buf;
+		xfer.rxBuff = 0;
+		queue_head = (queue_head + 1) % I2C_QUEUE_SIZE;
+		queue_count++;
+	}
+
+	// Records are the address and length followed by the bytes, a zero
+	// address ends a frame. Interrupts are off.
+	void Capture(uint8_t addr, const uint8_t *buf, uint32_t len) {
+#ifdef ENABLE_I2C_CAPTURE
+		if (!capturing) {
+			return;
+		}
+		if (len > 0xFF || (capture_len + 2 + len) > I2C_CAPTURE_SIZE) {
+			capturing = false;
+			capture_full = true;
+			return;
+		}
+		capture[capture_len++] = addr;
+		capture[capture_len++] = len;
+		memcpy(&capture[capture_len], buf, len);
+		capture_len += len;
+		capture_frame = addr != 0;
+#else  // #ifdef ENABLE_I2C_CAPTURE
+		(void)addr; (void)buf; (void)len;
+#endif  // #ifdef ENABLE_I2C_CAPTURE
+	}
+
+	// Where len contiguous bytes would go in the pool ring.
+	bool Room(uint32_t len, uint32_t *start) const {
+		uint32_t head = pool_head;
+		uint32_t tail = pool_tail;
+		if (queue_count == 0) {
+			head = 0;
+			tail = 0;
+		}
+		if (head >= tail) {
+			if ((I2C_POOL_SIZE - head) < len) {
+				// Wrap, the tail end stays unused
+				if (queue_count != 0 && tail <= len) {
+					return false;
+				}
+				if (queue_count == 0 && len > I2C_POOL_SIZE) {
+					return false;
+				}
+				head = 0;
+			}
+		} else if ((tail - head) <= len) {
+			return false;
+		}
+		*start = head;
+		return true;
+	}
+
+	// Contiguous space for both buffers in the pool ring.
+	bool Alloc(uint32_t len0, uint32_t len1, uint8_t **buf0, uint8_t **buf1) {
+		uint32_t len = len0 + len1;
+		uint32_t head = 0;
+		if (!Room(len, &head)) {
+			return false;
+		}
+		if (queue_count == 0) {
+			pool_tail = 0;
+		}
+		*buf0 = &pool[head];
+		*buf1 = &pool[head + len0];
+		pool_head = head + len;
+		return true;
 	}
+
+	void StartNext() {
+		if (urgent_count) {
+			current = urgent[0];
+			for (uint32_t c=1; c<urgent_count; c++) {
+				urgent[c-1] = urgent[c];
+			}
+			urgent_count--;
+			current_urgent = true;
+		} else if (queue_count) {
+			current = &queue[queue_tail];
+			current_urgent = false;
+		} else {
+			current = 0;
+			return;
+		}
+		transactions++;
+		current_start = Chip_TIMER_ReadCount(LPC_TIMER32_0);
+		Trace::Begin(Trace::I2C, current->slaveAddr);
+		Chip_I2CM_Xfer(LPC_I2C, current);
+	}
+
+	void Finish() {
+		Trace::End(Trace::I2C, current->status);
+		if (!current_urgent) {
+			// txBuff has moved past the data we sent
+			pool_tail = uint32_t(current->txBuff + current->txSz - pool);
+			queue_tail = (queue_tail + 1) % I2C_QUEUE_SIZE;
+			queue_count--;
+		}
+		current = 0;
+	}
+
+	void Recover() {
+		// Clock out whatever the slave thinks it is still sending, then
+		// put a STOP on the bus by hand.
+		Chip_I2C_DeInit(I2C0);
+		Chip_IOCON_PinMuxSet(LPC_IOCON, (I2C_SCL_PIN>>8), (I2C_SCL_PIN&0xFF), IOCON_FUNC0 | pin_func);
+		Chip_IOCON_PinMuxSet(LPC_IOCON, (I2C_SDA_PIN>>8), (I2C_SDA_PIN&0xFF), IOCON_FUNC0 | pin_func);
+		Chip_GPIO_SetPinDIRInput(LPC_GPIO, (I2C_SDA_PIN>>8), (I2C_SDA_PIN&0xFF));
+		Chip_GPIO_SetPinDIROutput(LPC_GPIO, (I2C_SCL_PIN>>8), (I2C_SCL_PIN&0xFF));
+		for (uint32_t c=0; c<9; c++) {
+			Chip_GPIO_SetPinState(LPC_GPIO, (I2C_SCL_PIN>>8), (I2C_SCL_PIN&0xFF), false);
+			BitDelay();
+			Chip_GPIO_SetPinState(LPC_GPIO, (I2C_SCL_PIN>>8), (I2C_SCL_PIN&0xFF), true);
+			BitDelay();
+		}
+		Chip_GPIO_SetPinDIROutput(LPC_GPIO, (I2C_SDA_PIN>>8), (I2C_SDA_PIN&0xFF));
+		Chip_GPIO_SetPinState(LPC_GPIO, (I2C_SDA_PIN>>8), (I2C_SDA_PIN&0xFF), false);
+		BitDelay();
+		Chip_GPIO_SetPinState(LPC_GPIO, (I2C_SDA_PIN>>8), (I2C_SDA_PIN&0xFF), true);
+		BitDelay();
+		Chip_GPIO_SetPinDIRInput(LPC_GPIO, (I2C_SCL_PIN>>8), (I2C_SCL_PIN&0xFF));
+		Chip_GPIO_SetPinDIRInput(LPC_GPIO, (I2C_SDA_PIN>>8), (I2C_SDA_PIN&0xFF));
+
+		Chip_SYSCTL_PeriphReset(RESET_I2C0);
+		Chip_IOCON_PinMuxSet(LPC_IOCON, (I2C_SCL_PIN>>8), (I2C_SCL_PIN&0xFF), IOCON_FUNC1 | pin_func);
+		Chip_IOCON_PinMuxSet(LPC_IOCON, (I2C_SDA_PIN>>8), (I2C_SDA_PIN&0xFF), IOCON_FUNC1 | pin_func);
+		Chip_I2C_Init(I2C0);
+		Chip_I2C_SetClockRate(I2C0, speed);
+		NVIC_ClearPendingIRQ(I2C0_IRQn);
+	}
+
+	static void BitDelay() {
+		// ~5us, half a 100kHz clock
+		for (volatile uint32_t i = 0; i < 40; i++) {
+		}
+	}
+
+	I2CM_XFER_T *current;
+	bool current_urgent;
+	uint32_t current_start;
+
+	I2CM_XFER_T queue[I2C_QUEUE_SIZE];
+	uint32_t queue_head;
+	uint32_t queue_tail;
+	uint32_t queue_count;
+
+	uint8_t pool[I2C_POOL_SIZE];
+	uint32_t pool_head;
+	uint32_t pool_tail;
+
+	I2CM_XFER_T *urgent[I2C_URGENT_SIZE];
+	uint32_t urgent_count;
+
+	uint32_t speed;
+	uint32_t pin_func;
+
+#ifdef ENABLE_I2C_CAPTURE
+	uint8_t capture[I2C_CAPTURE_SIZE];
+	uint32_t capture_len;
+	bool capturing;
+	bool capture_full;
+	bool capture_frame;
+	uint32_t dump_limit;
+	uint32_t dump_pos;
+	uint32_t dump_end;
+#endif  // #ifdef ENABLE_I2C_CAPTURE
 };
 
-volatile uint32_t I2C_Guard::i2c_guard = 0;
+static I2CBus i2c_bus;
 
 class FT25H16S {
 
@@ -1041,6 +1663,7 @@ public:
 	}
 
 	void write_data(uint32_t address, uint8_t *ptr, uint32_t size) {
+		Trace::Begin(Trace::FLASH_WRITE, size);
 		write_enable();
 		
 		// MOSI0
@@ -1064,8 +1687,19 @@ public:
 		Chip_GPIO_SetPinState(LPC_GPIO, (FLASH_CSEL_PIN>>8), (FLASH_CSEL_PIN&0xFF), true);
 		
 		while (wip()) { };
+		Trace::End(Trace::FLASH_WRITE, size);
 	}
 	
+	// 4KB sector containing address
+	void sector_erase(uint32_t address) {
+		erase(0x20, address);
+	}
+
+	// 64KB block containing address
+	void block_erase(uint32_t address) {
+		erase(0xD8, address);
+	}
+
 	void chip_erase() {
 		write_enable();
 		
@@ -1077,16 +1711,44 @@ public:
 		// HOLD to high
 		Chip_GPIO_SetPinState(LPC_GPIO, (FLASH_HOLD_PIN>>8), (FLASH_HOLD_PIN&0xFF), true);
 
+		Trace::Begin(Trace::FLASH_ERASE);
+
 		push_byte(0x60);
 
 		// CSEL to high
 		Chip_GPIO_SetPinState(LPC_GPIO, (FLASH_CSEL_PIN>>8), (FLASH_CSEL_PIN&0xFF), true);
 		
 		while (wip()) { };
+		Trace::End(Trace::FLASH_ERASE);
 	}
 
 private:
 
+	void erase(uint8_t cmd, uint32_t address) {
+		write_enable();
+
+		// MOSI0
+		Chip_IOCON_PinMuxSet(LPC_IOCON, (FLASH_MOSI0_PIN>>8), (FLASH_MOSI0_PIN&0xFF), IOCON_FUNC0);
+
+		// CSEL to low
+		Chip_GPIO_SetPinState(LPC_GPIO, (FLASH_CSEL_PIN>>8), (FLASH_CSEL_PIN&0xFF), false);
+		// HOLD to high
+		Chip_GPIO_SetPinState(LPC_GPIO, (FLASH_HOLD_PIN>>8), (FLASH_HOLD_PIN&0xFF), true);
+
+		Trace::Begin(Trace::FLASH_ERASE, address);
+
+		push_byte(cmd);
+		push_byte((address>>16)&0xFF);
+		push_byte((address>> 8)&0xFF);
+		push_byte((address>> 0)&0xFF);
+
+		// CSEL to high
+		Chip_GPIO_SetPinState(LPC_GPIO, (FLASH_CSEL_PIN>>8), (FLASH_CSEL_PIN&0xFF), true);
+
+		while (wip()) { };
+		Trace::End(Trace::FLASH_ERASE, address);
+	}
+
 	bool wip() {
 		// MOSI0
 		Chip_IOCON_PinMuxSet(LPC_IOCON, (FLASH_MOSI0_PIN>>8), (FLASH_MOSI0_PIN&0xFF), IOCON_FUNC0);
@@ -1134,6 +1796,330 @@ private:
 	}
 };
 
+// Bar graph glyphs for UI::DisplayBar(), 7 per value
+#ifndef ENABLE_ASSET_STORE
+static const uint8_t bar_chr_8[7*8] = {
+	0x6B, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x71,
+	0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x71,
+	0x6D, 0x70, 0x6E, 0x6E, 0x6E, 0x6E, 0x71,
+	0x6D, 0x70, 0x70, 0x6E, 0x6E, 0x6E, 0x71,
+	0x6D, 0x70, 0x70, 0x70, 0x6E, 0x6E, 0x71,
+	0x6D, 0x70, 0x70, 0x70, 0x70, 0x6E, 0x71,
+	0x6D, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71,
+	0x6D, 0x70, 0x70, 0x70, 0x70, 0x70, 0x73,
+};
+
+static const uint8_t bar_chr_14[7*14] = {
+	0x6B, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x71,
+	0x6C, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x71,
+	0x6D, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E, 0x71,
+	0x6D, 0x70, 0x6E, 0x6E, 0x6E, 0x6E, 0x71,
+	0x6D, 0x70, 0x70, 0x6E, 0x6E, 0x6E, 0x71,
+	0x6D, 0x70, 0x70, 0x6E, 0x6E, 0x6E, 0x71,
+	0x6D, 0x70, 0x70, 0x6F, 0x6E, 0x6E, 0x71,
+	0x6D, 0x70, 0x70, 0x70, 0x6E, 0x6E, 0x71,
+	0x6D, 0x70, 0x70, 0x70, 0x6F, 0x6E, 0x71,
+	0x6D, 0x70, 0x70, 0x70, 0x70, 0x6E, 0x71,
+	0x6D, 0x70, 0x70, 0x70, 0x70, 0x6F, 0x71,
+	0x6D, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71,
+	0x6D, 0x70, 0x70, 0x70, 0x70, 0x70, 0x72,
+	0x6D, 0x70, 0x70, 0x70, 0x70, 0x70, 0x73,
+};
+#endif  // #ifndef ENABLE_ASSET_STORE
+
+// Font data and tables kept at the top of the external flash. '@ASSET WRITE'
+// from a build without ENABLE_ASSET_STORE copies them out. A build with it
+// leaves them out of the internal flash and reads them back through a
+// small LRU cache of records.
+class AssetStore {
+
+public:
+
+	#define ASSET_BASE 0x1F0000
+	#define ASSET_MAGIC 0x54535341UL // 'ASST'
+	#define ASSET_HEADER_SIZE 16
+
+	// Offsets behind the header
+	#define ASSET_FONT 0
+	#define ASSET_BAR8 (ASSET_FONT + DUCK_FONT_DATA_SIZE)
+	#define ASSET_BAR14 (ASSET_BAR8 + 7*8)
+	#define ASSET_SIZE (ASSET_BAR14 + 7*14)
+
+	#define ASSET_CACHE_SIZE 32
+	#define ASSET_RECORD_SIZE 9	// mask and 8 columns of a glyph
+	#define ASSET_RUN_SIZE 64
+
+	static void Init(FT25H16S &_flash) {
+		flash = &_flash;
+#ifdef ENABLE_ASSET_STORE
+		for (uint32_t c=0; c<ASSET_CACHE_SIZE; c++) {
+			cache[c].offset = 0xFFFF;
+			cache[c].used = 0;
+		}
+		valid = Verify();
+#endif  // #ifdef ENABLE_ASSET_STORE
+	}
+
+	// Header matches this build and the contents are intact
+	static bool Verify() {
+		uint32_t header[4];
+		Read(0, reinterpret_cast<uint8_t *>(header), sizeof(header));
+		if (header[0] != ASSET_MAGIC || header[1] != ASSET_SIZE || header[3] != DUCK_FONT_CHECKSUM) {
+			return false;
+		}
+		uint32_t checksum = 0x811C9DC5UL;
+		uint8_t buf[ASSET_RUN_SIZE];
+		for (uint32_t off = 0; off < ASSET_SIZE; off += sizeof(buf)) {
+			uint32_t len = min(uint32_t(sizeof(buf)), uint32_t(ASSET_SIZE - off));
+			Read(ASSET_HEADER_SIZE + off, buf, len);
+			for (uint32_t c=0; c<len; c++) {
+				checksum = (checksum ^ buf[c]) * 0x01000193UL;
+			}
+		}
+		return checksum == header[2];
+	}
+
+#ifndef ENABLE_ASSET_STORE
+	// Erases and programs the store from the internal copies. Takes a
+	// while, the sector erases dominate.
+	static bool Write() {
+		uint32_t checksum = 0x811C9DC5UL;
+		for (uint32_t c=0; c<ASSET_SIZE; c++) {
+			checksum = (checksum ^ Source(c)) * 0x01000193UL;
+		}
+		const uint32_t header[4] = { ASSET_MAGIC, ASSET_SIZE, checksum, DUCK_FONT_CHECKSUM };
+
+		for (uint32_t off = 0; off < ASSET_HEADER_SIZE + ASSET_SIZE; off += 0x1000) {
+			flash->sector_erase(ASSET_BASE + off);
+		}
+		uint8_t page[256];
+		for (uint32_t off = 0; off < ASSET_HEADER_SIZE + ASSET_SIZE; off += sizeof(page)) {
+			for (uint32_t c=0; c<sizeof(page); c++) {
+				uint32_t a = off + c;
+				if (a < ASSET_HEADER_SIZE) {
+					page[c] = reinterpret_cast<const uint8_t *>(header)[a];
+				} else if (a < ASSET_HEADER_SIZE + ASSET_SIZE) {
+					page[c] = Source(a - ASSET_HEADER_SIZE);
+				} else {
+					page[c] = 0xFF;
+				}
+			}
+			flash->write_data(ASSET_BASE + off, page, sizeof(page));
+		}
+		return Verify();
+	}
+#endif  // #ifndef ENABLE_ASSET_STORE
+
+#ifdef ENABLE_ASSET_STORE
+	// Copies the ASSET_RECORD_SIZE bytes at offset to out, zeros if the
+	// store is missing. Copied under the lock, SysTick may render and
+	// evict the slot as soon as it is released.
+	static void Record(uint32_t offset, uint8_t *out) {
+		if (!valid) {
+			memset(out, 0, ASSET_RECORD_SIZE);
+			return;
+		}
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		Entry *entry = Find(offset);
+		if (entry) {
+			hits++;
+		} else {
+			misses++;
+			entry = Oldest();
+			Read(ASSET_HEADER_SIZE + offset, entry->data, ASSET_RECORD_SIZE);
+			entry->offset = uint16_t(offset);
+			entry->used = ++clock;
+		}
+		memcpy(out, entry->data, ASSET_RECORD_SIZE);
+		__set_PRIMASK(primask);
+	}
+
+	// Loads the records a screen is about to need. Neighbouring records
+	// are read in one go, which saves the command overhead of each one.
+	// Interrupts are only off per cache access and per Read(), a batch
+	// of runs would hold off SysTick for milliseconds.
+	static void Prefetch(const uint16_t *offsets, uint32_t count) {
+		if (!valid) {
+			return;
+		}
+		uint16_t missing[ASSET_CACHE_SIZE];
+		uint32_t n = 0;
+		for (uint32_t c=0; c<count && n<ASSET_CACHE_SIZE; c++) {
+			uint32_t primask = __get_PRIMASK();
+			__disable_irq();
+			bool cached = Find(offsets[c]) != 0;
+			__set_PRIMASK(primask);
+			if (cached) {
+				continue;
+			}
+			// Sorted insert, skipping duplicates
+			uint32_t i = n;
+			while (i > 0 && missing[i-1] > offsets[c]) {
+				i--;
+			}
+			if (i > 0 && missing[i-1] == offsets[c]) {
+				continue;
+			}
+			memmove(&missing[i+1], &missing[i], (n-i)*sizeof(missing[0]));
+			missing[i] = offsets[c];
+			n++;
+		}
+		uint32_t c = 0;
+		while (c < n) {
+			uint32_t start = missing[c];
+			uint32_t end = c;
+			while (end + 1 < n && (missing[end+1] + ASSET_RECORD_SIZE - start) <= ASSET_RUN_SIZE) {
+				end++;
+			}
+			uint8_t run[ASSET_RUN_SIZE];
+			Read(ASSET_HEADER_SIZE + start, run, missing[end] + ASSET_RECORD_SIZE - start);
+			uint32_t primask = __get_PRIMASK();
+			__disable_irq();
+			for (; c <= end; c++) {
+				// SysTick may have loaded it while the run was read
+				if (Find(missing[c])) {
+					continue;
+				}
+				Entry *entry = Oldest();
+				memcpy(entry->data, &run[missing[c] - start], ASSET_RECORD_SIZE);
+				entry->offset = missing[c];
+				entry->used = ++clock;
+				prefetched++;
+			}
+			__set_PRIMASK(primask);
+		}
+	}
+
+	static bool valid;
+	static uint32_t hits;
+	static uint32_t misses;
+	static uint32_t prefetched;
+#endif  // #ifdef ENABLE_ASSET_STORE
+
+private:
+
+#ifndef ENABLE_ASSET_STORE
+	static uint8_t Source(uint32_t offset) {
+		if (offset < ASSET_BAR8) {
+			return duck_font_data[offset - ASSET_FONT];
+		} else if (offset < ASSET_BAR14) {
+			return bar_chr_8[offset - ASSET_BAR8];
+		}
+		return bar_chr_14[offset - ASSET_BAR14];
+	}
+#endif  // #ifndef ENABLE_ASSET_STORE
+
+	static void Read(uint32_t offset, uint8_t *buf, uint32_t len) {
+		// The flash shares its clock with the LEDs pushed from SysTick
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		flash->read_data(ASSET_BASE + offset, buf, len);
+		__set_PRIMASK(primask);
+	}
+
+	static FT25H16S *flash;
+
+#ifdef ENABLE_ASSET_STORE
+	struct Entry {
+		uint8_t data[ASSET_RECORD_SIZE];
+		uint16_t offset;
+		uint16_t used;
+	};
+
+	static Entry *Find(uint32_t offset) {
+		for (uint32_t c=0; c<ASSET_CACHE_SIZE; c++) {
+			if (cache[c].offset == offset) {
+				cache[c].used = ++clock;
+				return &cache[c];
+			}
+		}
+		return 0;
+	}
+
+	static Entry *Oldest() {
+		uint32_t oldest = 0;
+		for (uint32_t c=1; c<ASSET_CACHE_SIZE; c++) {
+			if (uint16_t(clock - cache[c].used) > uint16_t(clock - cache[oldest].used)) {
+				oldest = c;
+			}
+		}
+		return &cache[oldest];
+	}
+
+	static Entry cache[ASSET_CACHE_SIZE];
+	static uint16_t clock;
+#endif  // #ifdef ENABLE_ASSET_STORE
+};
+
+FT25H16S *AssetStore::flash = 0;
+#ifdef ENABLE_ASSET_STORE
+AssetStore::Entry AssetStore::cache[ASSET_CACHE_SIZE];
+uint16_t AssetStore::clock = 0;
+bool AssetStore::valid = false;
+uint32_t AssetStore::hits = 0;
+uint32_t AssetStore::misses = 0;
+uint32_t AssetStore::prefetched = 0;
+#endif  // #ifdef ENABLE_ASSET_STORE
+
+// Where glyph ch starts in the font data, or ~0 for a blank glyph
+static uint32_t duck_font_record(uint16_t ch) {
+	uint32_t rel = (ch < DUCK_FONT_SLOTS) ? duck_font_index[ch] : 0;
+	if (!rel) {
+		return 0xFFFFFFFFUL;
+	}
+	uint32_t id = duck_font_base[ch / DUCK_FONT_INDEX_BLOCK] + rel - 1;
+	uint32_t offset = duck_font_offset[id / DUCK_FONT_OFFSET_GROUP];
+#ifdef ENABLE_ASSET_STORE
+	offset += duck_font_delta[id];
+#else  // #ifdef ENABLE_ASSET_STORE
+	// Skip the glyphs before it in its group, one byte per set mask bit
+	for (uint32_t c = id % DUCK_FONT_OFFSET_GROUP; c; c--) {
+		uint32_t m = duck_font_data[offset++];
+		m = m - ((m >> 1) & 0x55);
+		m = (m & 0x33) + ((m >> 2) & 0x33);
+		offset += (m + (m >> 4)) & 0x0F;
+	}
+#endif  // #ifdef ENABLE_ASSET_STORE
+	return offset;
+}
+
+// Unpacks the 8 columns of glyph ch, see tools/fontconv.cpp for the format
+static void duck_font_glyph(uint16_t ch, uint8_t *buf) {
+	uint32_t offset = duck_font_record(ch);
+	if (offset == 0xFFFFFFFFUL) {
+		memset(buf, 0, 8);
+		return;
+	}
+#ifdef ENABLE_ASSET_STORE
+	uint8_t record[ASSET_RECORD_SIZE];
+	AssetStore::Record(ASSET_FONT + offset, record);
+	const uint8_t *p = record;
+#else  // #ifdef ENABLE_ASSET_STORE
+	const uint8_t *p = &duck_font_data[offset];
+#endif  // #ifdef ENABLE_ASSET_STORE
+	uint32_t mask = *p++;
+	for (uint32_t x = 0; x < 8; x++) {
+		buf[x] = (mask & (1 << x)) ? *p++ : 0;
+	}
+}
+
+// Longest sleep between the RX windows of the duty cycled receiver,
+// 0 keeps it listening all the time
+#define RADIO_SNIFF_MAX_MS 1000
+
+// Built-in radio messages, a compact frame sends these by index
+static const char radio_presets[8][9] = {
+	" QUACK! ",
+	"  NOW!  ",
+	"  !NO!  ",
+	"  YES!  ",
+	"WAITING!",
+	"I'M OUT!",
+	"CAMPTIME",
+	"!SAFETY!",
+};
+
 class EEPROM {
 
 public:
@@ -1151,15 +2137,11 @@ public:
 		radio_enabled = true;
 		radio_message = 0;
 		radio_color = 0;
+		radio_sniff_ms = 0;
 
-		memcpy(radio_messages[0], " QUACK! ", 8);
-		memcpy(radio_messages[1], "  NOW!  ", 8);
-		memcpy(radio_messages[2], "  !NO!  ", 8);
-		memcpy(radio_messages[3], "  YES!  ", 8);
-		memcpy(radio_messages[4], "WAITING!", 8);
-		memcpy(radio_messages[5], "I'M OUT!", 8);
-		memcpy(radio_messages[6], "CAMPTIME", 8);
-		memcpy(radio_messages[7], "!SAFETY!", 8);
+		for (uint32_t c=0; c<8; c++) {
+			memcpy(radio_messages[c], radio_presets[c], 8);
+		}
 
 		memcpy(&radio_name[0], "DUCKLING", 8);
 		
@@ -1193,15 +2175,11 @@ public:
 		radio_enabled = true;
 		radio_message = 0;
 		radio_color = 0;
+		radio_sniff_ms = 0;
 		
-		memcpy(radio_messages[0], " QUACK! ", 8);
-		memcpy(radio_messages[1], "  NOW!  ", 8);
-		memcpy(radio_messages[2], "  !NO!  ", 8);
-		memcpy(radio_messages[3], "  YES!  ", 8);
-		memcpy(radio_messages[4], "WAITING!", 8);
-		memcpy(radio_messages[5], "I'M OUT!", 8);
-		memcpy(radio_messages[6], "CAMPTIME", 8);
-		memcpy(radio_messages[7], "!SAFETY!", 8);
+		for (uint32_t c=0; c<8; c++) {
+			memcpy(radio_messages[c], radio_presets[c], 8);
+		}
 		
 		Save();
 	}
@@ -1229,6 +2207,12 @@ public:
 			Reset(true);
 		}
 
+		// Appended after the message history, an EEPROM written by an
+		// older firmware may hold anything here
+		if (radio_sniff_ms > RADIO_SNIFF_MAX_MS) {
+			radio_sniff_ms = 0;
+		}
+
 		runtime_time_count = Chip_TIMER_ReadCount(LPC_TIMER32_0);
 		recv_radio_message_pending = false;
 		
@@ -1237,6 +2221,7 @@ public:
 
 	void Save() {
 		if (loaded) {
+			Trace::Begin(Trace::EEPROM_SAVE);
 			unsigned int param[5] = { 0 };
 			param[0] = 61; // Write EEPROM
 			param[1] = 0; // EEPROM address
@@ -1245,6 +2230,8 @@ public:
 			param[4] = SystemCoreClock / 1000; // CCLK
 			unsigned int result[4] = { 0 };
 			iap_entry(param, result);
+			Trace::End(Trace::EEPROM_SAVE, result[0]);
+			ui_invalid |= UI_INVALID_SETTINGS;
 		}
 	}
 
@@ -1282,6 +2269,14 @@ public:
 		}
 	}
 
+	uint32_t UnsavedRuntime() const {
+		return Chip_TIMER_ReadCount(LPC_TIMER32_0) - runtime_time_count;
+	}
+
+	void RestoreRuntime(uint32_t unsaved_runtime) {
+		total_runtime += unsaved_runtime;
+	}
+
 	void SaveRuntime() {
 		if (loaded) {
 			uint32_t new_runtime_time_count = Chip_TIMER_ReadCount(LPC_TIMER32_0);
@@ -1295,15 +2290,19 @@ public:
 	#define MSG_SIZE 32
 	
 	void RecordMessage(FT25H16S &ft25h16s, const uint8_t *msg) {
+		Trace::Begin(Trace::RECORD_MESSAGE, recv_buffer_ptr);
 		memcpy(&recv_buffer[recv_buffer_ptr], msg, 24);
 		recv_buffer_ptr += 32;
 		if (recv_buffer_ptr >= 0x100) {
-			// Spill into flash
-			ft25h16s.write_data(recv_flash_ptr, recv_buffer, 256);
+			// Spill into flash, the top is reserved for the asset store
+			if ((recv_flash_ptr + BLOCK_SIZE) <= ASSET_BASE) {
+				ft25h16s.write_data(recv_flash_ptr, recv_buffer, 256);
+				recv_flash_ptr += BLOCK_SIZE;
+			}
 			recv_buffer_ptr = 0;
-			recv_flash_ptr += BLOCK_SIZE;
 		}
 		Save();
+		Trace::End(Trace::RECORD_MESSAGE, recv_buffer_ptr);
 	}
 	
 	int32_t GetMessageCount() {
@@ -1354,34 +2353,204 @@ public:
 	uint8_t  recv_buffer[256];
 	uint32_t recv_flash_ptr;
 
+	uint32_t radio_sniff_ms;
+
 };
 
 bool EEPROM::loaded = 0;
- 
-class SPI;
 
-class LEDs {
+class WarmState {
 
-#define HALF_LEDS 			12
+	#define WARM_STATE_MAGIC 0x4B435544UL // 'DUCK'
+	#define WARM_RESUME_MAX 3
+	#define WARM_STABLE_MS 10000
 
-	const uint8_t frnt_ring_indecies[8] = { 0x04*3, 0x05*3, 0x06*3, 0x07*3, 0x08*3, 0x09*3, 0x0A*3, 0x0B*3 };
-	const uint8_t back_ring_indecies[8] = { 0x04*3, 0x05*3, 0x06*3, 0x07*3, 0x08*3, 0x09*3, 0x0A*3, 0x0B*3 };
-	const uint8_t frnt_bird_indecies[4] = { 0x00*3, 0x01*3, 0x02*3, 0x03*3 };
-	const uint8_t back_bird_indecies[4] = { 0x00*3, 0x01*3, 0x02*3, 0x03*3 };
+	public:
+		// Lives in .noinit so it survives watchdog and soft resets. After a
+		// power cycle the checksum will not match and we do a cold boot.
+		bool Valid() const {
+			return magic == WARM_STATE_MAGIC && checksum == Checksum();
+		}
 
-public:
+		void Invalidate() {
+			magic = 0;
+			checksum = 0;
+		}
 
-	LEDs() {
-		memset(led_data, 0, sizeof(led_data));
-	}
+		// A state which crashes us again right after the resume would
+		// otherwise be restored forever.
+		bool CrashLoop() const {
+			return warm_streak >= WARM_RESUME_MAX;
+		}
 
-	void set_ring(uint32_t index, uint32_t r, uint32_t g, uint32_t b) {
-		led_data[HALF_LEDS*0*3+frnt_ring_indecies[index]+1] = r;
-		led_data[HALF_LEDS*0*3+frnt_ring_indecies[index]+0] = g;
-		led_data[HALF_LEDS*0*3+frnt_ring_indecies[index]+2] = b;
-		led_data[HALF_LEDS*1*3+back_ring_indecies[index]+1] = r;
-		led_data[HALF_LEDS*1*3+back_ring_indecies[index]+0] = g;
-		led_data[HALF_LEDS*1*3+back_ring_indecies[index]+2] = b;
+		void Snapshot(uint32_t _program_curr, uint32_t _ui_mode, uint32_t _unsaved_runtime) {
+			magic = WARM_STATE_MAGIC;
+			if (warm_streak && int32_t(system_clock_ms - stable_ms) >= 0) {
+				warm_streak = 0;
+			}
+			clock_ms = system_clock_ms;
+			program_curr = _program_curr;
+			ui_mode = _ui_mode;
+			unsaved_runtime = _unsaved_runtime;
+			checksum = Checksum();
+		}
+
+		void ColdBoot() {
+			Invalidate();
+			warm_resume_count = 0;
+			warm_streak = 0;
+		}
+
+		void CountResume() {
+			warm_resume_count++;
+			warm_streak++;
+			stable_ms = system_clock_ms + WARM_STABLE_MS;
+			checksum = Checksum();
+		}
+
+		uint32_t magic;
+		uint32_t clock_ms;
+		uint32_t program_curr;
+		uint32_t ui_mode;
+		uint32_t unsaved_runtime;
+		uint32_t warm_resume_count;
+		uint32_t warm_streak;	// resumes without WARM_STABLE_MS of uptime in between
+		uint32_t stable_ms;
+		uint32_t checksum;
+
+	private:
+		uint32_t Checksum() const {
+			const uint32_t *p = &magic;
+			uint32_t sum = 0x811C9DC5UL;
+			while (p < &checksum) {
+				sum = rot(sum, 5) ^ *p++;
+			}
+			return sum;
+		}
+};
+
+static WarmState warm_state __attribute__ ((section(".noinit")));
+
+extern "C" uint32_t _pvHeapStart;
+extern "C" uint32_t _vStackTop;
+
+class StackMonitor {
+
+	// Has to match the pattern painted in cr_startup_lpc11xx.c
+	#define STACK_PAINT 0xC5C5C5C5
+	// Fall back once the stack comes this close to the static data
+	#define STACK_GUARD_BYTES 256
+	#define STACK_EFFECTS 32
+
+public:
+
+	static uint32_t Size() {
+		return uintptr_t(&_vStackTop) - uintptr_t(&_pvHeapStart);
+	}
+
+	// Unused bytes above the static data since the last Repaint()
+	static uint32_t Free() {
+		const uint32_t *bottom = &_pvHeapStart;
+		const uint32_t *top = &_vStackTop;
+		const uint32_t *ptr = bottom;
+		while (ptr < top && *ptr == STACK_PAINT) {
+			ptr++;
+		}
+		return uintptr_t(ptr) - uintptr_t(bottom);
+	}
+
+	static uint32_t MinFree() {
+		Update();
+		return min_free;
+	}
+
+	static void Update() {
+		uint32_t free = Free();
+		if (free < min_free) {
+			min_free = free;
+		}
+	}
+
+	static bool GuardIntact() {
+		const uint32_t *bottom = &_pvHeapStart;
+		for (uint32_t c=0; c<STACK_GUARD_BYTES/4; c++) {
+			if (bottom[c] != STACK_PAINT) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Peak stack use of an effect, including the interrupts which ran
+	// on top of it.
+	static uint32_t EffectPeak(uint32_t effect) {
+		if (effect >= STACK_EFFECTS) {
+			return 0;
+		}
+		if (effect == current_effect) {
+			uint32_t used = Size() - Free();
+			if (used > effect_peak[effect]) {
+				effect_peak[effect] = uint16_t(used);
+			}
+		}
+		return effect_peak[effect];
+	}
+
+	// Called from the main loop between effects, paints everything
+	// below the current stack pointer again.
+	static void BeginEffect(uint32_t effect) {
+		EffectPeak(current_effect);
+		Update();
+		// Volatile so this does not become a memset() painting over its
+		// own stack frame
+		volatile uint32_t *ptr = &_pvHeapStart;
+		uint32_t *sp = (uint32_t *)uintptr_t(__get_MSP());
+		while (ptr < sp) {
+			*ptr++ = STACK_PAINT;
+		}
+		current_effect = effect;
+		tripped = false;
+	}
+
+	static uint32_t fallback_count;
+	static bool tripped;
+
+private:
+	static uint32_t min_free;
+	static uint32_t current_effect;
+	static uint16_t effect_peak[STACK_EFFECTS];
+};
+
+uint32_t StackMonitor::fallback_count = 0;
+bool StackMonitor::tripped = false;
+uint32_t StackMonitor::min_free = 0xFFFFFFFF;
+uint32_t StackMonitor::current_effect = STACK_EFFECTS;
+uint16_t StackMonitor::effect_peak[STACK_EFFECTS] = { 0 };
+ 
+class SPI;
+
+class LEDs {
+
+#define HALF_LEDS 			12
+
+	const uint8_t frnt_ring_indecies[8] = { 0x04*3, 0x05*3, 0x06*3, 0x07*3, 0x08*3, 0x09*3, 0x0A*3, 0x0B*3 };
+	const uint8_t back_ring_indecies[8] = { 0x04*3, 0x05*3, 0x06*3, 0x07*3, 0x08*3, 0x09*3, 0x0A*3, 0x0B*3 };
+	const uint8_t frnt_bird_indecies[4] = { 0x00*3, 0x01*3, 0x02*3, 0x03*3 };
+	const uint8_t back_bird_indecies[4] = { 0x00*3, 0x01*3, 0x02*3, 0x03*3 };
+
+public:
+
+	LEDs() {
+		memset(led_data, 0, sizeof(led_data));
+	}
+
+	void set_ring(uint32_t index, uint32_t r, uint32_t g, uint32_t b) {
+		led_data[HALF_LEDS*0*3+frnt_ring_indecies[index]+1] = r;
+		led_data[HALF_LEDS*0*3+frnt_ring_indecies[index]+0] = g;
+		led_data[HALF_LEDS*0*3+frnt_ring_indecies[index]+2] = b;
+		led_data[HALF_LEDS*1*3+back_ring_indecies[index]+1] = r;
+		led_data[HALF_LEDS*1*3+back_ring_indecies[index]+0] = g;
+		led_data[HALF_LEDS*1*3+back_ring_indecies[index]+2] = b;
 	}
 
 	void set_ring(uint32_t index, const rgba &color) {
@@ -1444,6 +2613,12 @@ public:
 		led_data[HALF_LEDS*1*3+back_bird_indecies[index]+2] = b;
 	}
 
+	// LED 0-23 as last set, front half first
+	rgba get(uint32_t index) const {
+		const uint8_t *p = &led_data[index*3];
+		return rgba(p[1], p[0], p[2]);
+	}
+
 	void set_bird(uint32_t index, const rgba &color) {
 		led_data[HALF_LEDS*0*3+frnt_bird_indecies[index]+1] = color.r();
 		led_data[HALF_LEDS*0*3+frnt_bird_indecies[index]+0] = color.g();
@@ -1493,6 +2668,8 @@ public:
 	}
 
 	void push_frame(LEDs &leds, int32_t brightness = 0x01)  {
+		uint32_t trace_start = Trace::Start();
+
 		// MOSI0
 		Chip_IOCON_PinMuxSet(LPC_IOCON, (BOTTOM_LED_MOSI0_PIN>>8), (BOTTOM_LED_MOSI0_PIN&0xFF), IOCON_FUNC1);
 
@@ -1531,6 +2708,8 @@ public:
 		push_byte_btm(0xFF);
 		push_byte_top(0xFF);
 		push_byte_btm(0xFF);
+
+		Trace::Complete(Trace::LED_PUSH, trace_start);
 	}
 
 	void push_null()  {
@@ -1599,11 +2778,6 @@ class BQ24295 {
 			}
 			
 			void SetBoostVoltage (uint32_t voltageMV) {
-				I2C_Guard guard;
-				if (guard.Check()) {
-					return;
-				}
-				
 				uint8_t reg = getRegister(0x06);
 				if ((voltageMV >= 4550) && (voltageMV <= 5510)) {
 					uint32_t codedValue = voltageMV;
@@ -1618,22 +2792,12 @@ class BQ24295 {
 			}
 			
 			uint32_t GetBoostVoltage () {
-				I2C_Guard guard;
-				if (guard.Check()) {
-					return 0;
-				}
-
 				uint8_t reg = getRegister(0x06);
 				reg = (reg >> 4) & 0x0f;
 				return 4550 + ((uint32_t) reg) * 64;
 			}
 
 			void SetBoostUpperTemperatureLimit (uint32_t temperatureC) {
-				I2C_Guard guard;
-				if (guard.Check()) {
-					return;
-				}
-
 				uint8_t reg = getRegister(0x06);
 				uint8_t codedValue = 0;
 				if (temperatureC < 60) {
@@ -1649,11 +2813,6 @@ class BQ24295 {
 			}
 
 			uint32_t GetBoostUpperTemperatureLimit () {
-				I2C_Guard guard;
-				if (guard.Check()) {
-					return 0;
-				}
-
 				uint8_t reg = getRegister(0x06);
 				if (((reg >> 2) & 0x03) != 0x03) {
 					switch ((reg >> 2) & 0x03) {
@@ -1672,11 +2831,6 @@ class BQ24295 {
 			}
 
 			void SetInputCurrentLimit(uint32_t currentMA) {
-				I2C_Guard guard;
-				if (guard.Check()) {
-					return;
-				}
-
 				uint8_t reg = 0;
 				if ((reg = getRegister(0x00)) != 0) {
 					// Input current limit is in bits 0 to 2, coded
@@ -1710,11 +2864,6 @@ class BQ24295 {
 			}
 			
 			uint32_t GetInputCurrentLimit() {
-				I2C_Guard guard;
-				if (guard.Check()) {
-					return 0;
-				}
-
 				uint8_t reg = getRegister(0x00);
 				switch (reg & 0x07) {
 					case 0:
@@ -1746,18 +2895,10 @@ class BQ24295 {
 			}
 
 			void EnableInputLimits() {
-				I2C_Guard guard;
-				if (guard.Check()) {
-					return;
-				}
 				setRegisterBits(0x00, (1 << 7));
 			}
 			
 			void DisableInputLimits() {
-				I2C_Guard guard;
-				if (guard.Check()) {
-					return;
-				}
 				clearRegisterBits(0x00, (1 << 7));
 			}
 			
@@ -1771,10 +2912,6 @@ class BQ24295 {
 			}
 
 			void SetChipThermalRegulationThreshold(uint32_t temperatureC) {
-				I2C_Guard guard;
-				if (guard.Check()) {
-					return;
-				}
 				uint8_t reg = getRegister(0x06);
 				uint8_t codedValue = 0;
 				if (temperatureC < 80) {
@@ -1792,10 +2929,6 @@ class BQ24295 {
 			}
 			
 			uint32_t GetChipThermalRegulationThreshold() {
-				I2C_Guard guard;
-				if (guard.Check()) {
-					return 0;
-				}
 				uint8_t reg = getRegister(0x06);
 				switch (reg & 0x03) {
 					case 0:
@@ -1815,10 +2948,6 @@ class BQ24295 {
 			}
 			
 			uint8_t GetStatus() {
-				I2C_Guard guard;
-				if (guard.Check()) {
-					return 0;
-				}
 				return getRegister(0x08);
 			}
 			
@@ -1827,10 +2956,6 @@ class BQ24295 {
 			}
 			
 			bool IsInFaultState() {
-				I2C_Guard guard;
-				if (guard.Check()) {
-					return 0;
-				}
 				uint8_t reg = getRegister(0x09);
 				fault_state = reg;
 				return reg != 0;
@@ -1842,8 +2967,7 @@ class BQ24295 {
 
 			uint8_t getRegister(uint8_t address) {
 				uint8_t value = 0;
-				Chip_I2C_MasterSend(I2C0, i2caddr, &address, 1);
-				Chip_I2C_MasterRead(I2C0, i2caddr, &value, 1);
+				i2c_bus.Transfer(i2caddr, &address, 1, &value, 1);
 				return value;
 			}
 
@@ -1851,7 +2975,7 @@ class BQ24295 {
 				uint8_t set[2];
 				set[0] = address;
 				set[1] = value;
-				Chip_I2C_MasterSend(I2C0, i2caddr, &set[0], 2);
+				i2c_bus.Transfer(i2caddr, &set[0], 2, 0, 0);
 			}
 
 			void setRegisterBits(uint8_t address, uint8_t mask) {
@@ -1879,10 +3003,34 @@ class SDD1306 {
 	
  			static const uint32_t i2caddr = 0x3C;
 
+			#define GLYPH_CACHE_SIZE 8
+
 			SDD1306() {
 				devicePresent = false;
+				transition_type = TRANSITION_FLIP;
+				transition_screen = 0;
+				transition_cache = 0;
+				transition_pending = false;
+				transition_us = 0;
+				transition_us_max = 0;
+				// attr 0 is never cached, so these never match
+				memset(glyph_cache, 0, sizeof(glyph_cache));
+				glyph_cache_clock = 0;
+				glyph_cache_hits = 0;
+				glyph_cache_misses = 0;
 				display_scroll_message = false;
-				scroll_message_offset = 0;
+				memset(scroll_message, 0, sizeof(scroll_message));
+				scroll_start_ms = 0;
+				scroll_ring_pos = 0;
+				scroll_ring_valid = false;
+				scroll_screen_pos = 0;
+				scroll_screen_valid = false;
+				display_transactions = 0;
+				display_bytes = 0;
+				display_transactions_max = 0;
+				display_bytes_max = 0;
+				vertical_shift = 0;
+				vertical_shift_screen = 0;
 			}
 			
 			void Clear() {
@@ -1890,13 +3038,27 @@ class SDD1306 {
 				memset(text_buffer_screen, 0, sizeof(text_buffer_screen));
 				memset(text_attr_cache, 0, sizeof(text_attr_cache));
 				memset(text_attr_screen, 0, sizeof(text_attr_screen));
-				center_flip_screen = 0;
-				center_flip_cache = 0;
+				transition_screen = 0;
+				transition_cache = 0;
+				transition_pending = false;
 			}
 			
 			void ClearAttr() {
 				memset(text_attr_cache, 0, sizeof(text_attr_cache));
 			}
+
+			void ClearText() {
+				memset(text_buffer_cache, 0, sizeof(text_buffer_cache));
+			}
+			
+			// Force a full redraw on the next Display(), used when the
+			// panel content is unknown.
+			void Invalidate() {
+				memset(text_buffer_screen, 0xFF, sizeof(text_buffer_screen));
+				scroll_screen_valid = false;
+				// Not a shift SetVerticalShift() takes, resent as well
+				vertical_shift_screen = INT8_MIN;
+			}
 			
 			void DisplayBootScreen() {
 				for (uint32_t c=0; c<8*4; c++) {
@@ -1904,8 +3066,18 @@ class SDD1306 {
 				}
 			}
 			
-			void SetCenterFlip(int8_t progression) {
-				center_flip_cache = progression;
+			enum Transition {
+				TRANSITION_FLIP,
+				TRANSITION_WIPE,
+				TRANSITION_SLIDE,
+				TRANSITION_DISSOLVE,
+				TRANSITION_COUNT
+			};
+
+			// Progression 0 shows the screen as is, 32 is fully blank
+			void SetTransition(int8_t progression, Transition type = TRANSITION_FLIP) {
+				transition_type = type;
+				transition_cache = progression;
 			}
 
 			void PlaceAsciiStr(uint32_t x, uint32_t y, const char *str) {
@@ -1938,102 +3110,139 @@ class SDD1306 {
 				text_attr_cache[y*8+x] = attr;
 			}
 			
-			void SetAsciiScrollMessage(const char *str, int32_t offset) {
+			#define SCROLL_COLUMN_MS 4
+
+			// Scrolls str through the top two pages at one column every
+			// SCROLL_COLUMN_MS. Setting the same message again keeps it going.
+			void SetAsciiScrollMessage(const char *str) {
 				if (str) {
+					uint8_t message[9];
 					size_t len = min(strlen(str), size_t(8));
-					memset(scroll_message, 0, 9);
+					memset(message, 0, 9);
 					for (size_t c=0; c<len; c++) {
 						uint8_t ch = uint8_t(str[c]);
 						if ((ch < 0x20) || (ch >= 0x7D)) {
-							scroll_message[c] = 0x20;
+							message[c] = 0x20;
 						} else {
-							scroll_message[c] = ch - 0x20;
+							message[c] = ch - 0x20;
 						}
 					}
+					if (!display_scroll_message || memcmp(message, scroll_message, 9) != 0) {
+						memcpy(scroll_message, message, 9);
+						scroll_start_ms = system_clock_ms;
+						scroll_ring_valid = false;
+						scroll_screen_valid = false;
+					}
 					display_scroll_message = true;
-					scroll_message_offset = offset;
-				} else {
+				} else if (display_scroll_message) {
 					display_scroll_message = false;
+					// The text cells under the scroller need to be redrawn
+					for (uint32_t c=0; c<2*8; c++) {
+						text_buffer_screen[c] = 0xFFFF;
+					}
 				}
 			}
 
 			void Display() {
-				bool display_center_flip = false;
-				if (center_flip_cache || center_flip_screen) {
-					center_flip_screen = center_flip_cache;
-					display_center_flip = true;
+				display_transactions = 0;
+				display_bytes = 0;
+
+				// Nothing here waits for the bus, whatever does not fit into
+				// the I2C queue stays dirty and goes out on the next call.
+				SendVerticalShift();
+
+				bool display_transition = false;
+				if (transition_cache || transition_screen || transition_pending) {
+					transition_screen = transition_cache;
+					display_transition = true;
 				}
+#ifdef ENABLE_ASSET_STORE
+				PrefetchGlyphs();
+#endif  // #ifdef ENABLE_ASSET_STORE
 				for (uint32_t y=0; y<4; y++) {
 					if (display_scroll_message && y < 2) {
-						I2C_Guard guard;
-						if (guard.Check()) {
-							return;
-						}
-						
-						{
-							WriteCommand(0xB0+0);
-							int32_t x=32;
-							WriteCommand(0x0f&(x   )); // 0x20 offset
-							WriteCommand(0x10|(x>>4)); // 0x20 offset
-						}
-
-						uint8_t buf[65];
-						buf[0] = 0x40;
-						
-						// write first line
-						for (int32_t x = 0; x < 64; x++) {
-							int32_t rx = (scroll_message_offset + x ) % (9 * 16) ;
-							int32_t cx = rx >> 4;
-							buf[x+1] = duck_font_raw[0x1000 + scroll_message[cx] * 16 + (rx & 0x0F)];
-						}
-
-						Chip_I2C_MasterSend(I2C0, i2caddr, buf, 0x41);
-						
-						{
-							WriteCommand(0xB0+1);
-							int32_t x=32;
-							WriteCommand(0x0f&(x   )); // 0x20 offset
-							WriteCommand(0x10|(x>>4)); // 0x20 offset
-						}
-
-						// write first line
-						for (int32_t x = 0; x < 64; x++) {
-							int32_t rx = (scroll_message_offset + x ) % (9 * 16) ;
-							int32_t cx = rx >> 4;
-							buf[x+1] = duck_font_raw[0x1800 + scroll_message[cx] * 16 + (rx & 0x0F)];
-						}
-						
-						Chip_I2C_MasterSend(I2C0, i2caddr, buf, 0x41);
-						
+						DisplayScrollMessage();
+						y++;
 					} else {
-						for (uint32_t x=0; x<8; x++) {
-							if (text_buffer_cache[y*8+x] != text_buffer_screen[y*8+x] ||
-								text_attr_cache[y*8+x] != text_attr_screen[y*8+x]) {
-								text_buffer_screen[y*8+x] = text_buffer_cache[y*8+x];
-								text_attr_screen[y*8+x] = text_attr_cache[y*8+x];
-								if (!display_center_flip) {
-									DisplayChar(x,y,text_buffer_screen[y*8+x],text_attr_screen[y*8+x]);
+						// Merge adjacent changed cells into a single window
+						uint32_t x = 0;
+						while (x < 8) {
+							if (!CellDirty(x, y)) {
+								x++;
+								continue;
+							}
+							uint8_t buf[65];
+							buf[0] = 0x40;
+							uint32_t sx = x;
+							for (; x < 8 && CellDirty(x, y); x++) {
+								if (!display_transition) {
+									RenderChar(&buf[1+(x-sx)*8], text_buffer_cache[y*8+x], text_attr_cache[y*8+x]);
+								}
+							}
+							if (!display_transition) {
+								if (!SendWindow(sx*8+32, x*8+32-1, y, y, buf, 1+(x-sx)*8)) { // 0x20 offset
+									continue;
 								}
 							}
+							for (uint32_t c=sx; c<x; c++) {
+								text_buffer_screen[y*8+c] = text_buffer_cache[y*8+c];
+								text_attr_screen[y*8+c] = text_attr_cache[y*8+c];
+							}
 						}
 					}
 				}
-				if (display_center_flip) {
-					DisplayCenterFlip();
+				if (display_transition) {
+					DisplayTransition();
+				}
+				if (display_transactions > display_transactions_max) {
+					display_transactions_max = display_transactions;
+				}
+				if (display_bytes > display_bytes_max) {
+					display_bytes_max = display_bytes;
 				}
 				Chip_WWDT_Feed(LPC_WWDT);
 			}
-			
-			void SetVerticalShift(int8_t val) {
-				WriteCommand(0xD3);
-				if (val < 0) {
-					val = 64+val;
-					WriteCommand(val&0x3F);
-				} else {
-					WriteCommand(val&0x3F);
+
+			// Display() until all of it is on the panel, for screens which
+			// have to show before something long and blocking
+			void DisplayWait() {
+				for (;;) {
+					Display();
+					bool dirty = transition_pending || vertical_shift != vertical_shift_screen;
+					for (uint32_t c=0; c<8*4; c++) {
+						dirty |= CellDirty(c & 7, c >> 3);
+					}
+					if (!dirty && i2c_bus.Idle()) {
+						return;
+					}
+					i2c_bus.CheckTimeout();
 				}
 			}
 
+			// I2C traffic of the last Display() call and the worst so far
+			uint32_t DisplayTransactions() const { return display_transactions; }
+			uint32_t DisplayBytes() const { return display_bytes; }
+			uint32_t DisplayTransactionsMax() const { return display_transactions_max; }
+			uint32_t DisplayBytesMax() const { return display_bytes_max; }
+
+			// Time spent building the last transition frame and the worst so far
+			uint32_t TransitionMicros() const { return transition_us; }
+			uint32_t TransitionMicrosMax() const { return transition_us_max; }
+
+			uint32_t GlyphCacheHits() const { return glyph_cache_hits; }
+			uint32_t GlyphCacheMisses() const { return glyph_cache_misses; }
+
+			// Text cells as the UI placed them, 0-31 row by row
+			uint16_t CellChar(uint32_t c) const { return text_buffer_cache[c]; }
+			uint8_t CellAttr(uint32_t c) const { return text_attr_cache[c]; }
+
+			// Queued without waiting, Display() retries it if the queue
+			// was full
+			void SetVerticalShift(int8_t val) {
+				vertical_shift = val;
+				SendVerticalShift();
+			}
+
 			void DisplayOn() {
 				WriteCommand(0xAF);
 			}
@@ -2064,18 +3273,23 @@ class SDD1306 {
 				Display();
 			}
 			
-			void Init() const {
+			void Init(bool reset = true) {
 
 				// Toggle RESET line
 				Chip_GPIO_SetPinDIROutput(LPC_GPIO, 0, 22);
 				Chip_GPIO_SetPinState(LPC_GPIO, 0, 22, true);
-				delay(1);
-				Chip_GPIO_SetPinState(LPC_GPIO, 0, 22, false);
-				delay(10);
-				Chip_GPIO_SetPinState(LPC_GPIO, 0, 22, true);
+				if (reset) {
+					delay(1);
+					Chip_GPIO_SetPinState(LPC_GPIO, 0, 22, false);
+					delay(10);
+					Chip_GPIO_SetPinState(LPC_GPIO, 0, 22, true);
+				}
+
 
+				// tools/replay primes its panel model with a copy
+				static const uint8_t startup_sequence[] = {
+					0x00,			// Command stream
 
-				static uint8_t startup_sequence[] = {
 					0xAE,			// Display off
 
 					0xD5, 0x80,		// Set Display Clock Divide Ratio
@@ -2088,6 +3302,8 @@ class SDD1306 {
 
 					0x40,			// Set Display RAM start
 
+					0x20, 0x00,		// Horizontal addressing mode, see SetWindow()
+
 					0xA6,			// Set to normal display (0xA7 == inverse)
 					
 					0xA4,			// Force Display From RAM On
@@ -2107,9 +3323,8 @@ class SDD1306 {
 					0xAF			// Display on
 				};
 
-				for (size_t c = 0; c < sizeof(startup_sequence); c++) {
-					WriteCommand(startup_sequence[c]);
-				}
+				i2c_bus.WriteWait(i2caddr, startup_sequence, sizeof(startup_sequence));
+				vertical_shift_screen = 0;
 
 			}
 
@@ -2117,115 +3332,286 @@ class SDD1306 {
 
 	private:
 
-			void DisplayCenterFlip() {
-				I2C_Guard guard;
-				if (guard.Check()) {
+			// Source column for every panel column (-1 is blank) and a dither
+			// mask per column phase, built once per frame from the progression.
+			void BuildTransition(int8_t *map, uint8_t *mask) const {
+				int32_t p = constrain(int32_t(transition_screen), int32_t(0), int32_t(32));
+				memset(mask, 0xFF, 4);
+				switch (transition_type) {
+					default:
+					case TRANSITION_FLIP: {
+						memset(map, -1, 64);
+						if (p == 32) {
+							break;
+						}
+						// rx = 32 + (x-32)*32/(32-p), walked outwards from the center.
+						// The step is rounded up so the truncated column is exact.
+						uint32_t step = ((32UL << 16) + uint32_t(31 - p)) / uint32_t(32 - p);
+						uint32_t acc = 0;
+						for (int32_t d = 0; d <= 32; d++, acc += step) {
+							int32_t o = int32_t(acc >> 16);
+							if (o > 32) {
+								break;
+							}
+							if (d < 32 && o < 32) {
+								map[32+d] = int8_t(32+o);
+							}
+							if (d > 0) {
+								map[32-d] = int8_t(32-o);
+							}
+						}
+					} break;
+					case TRANSITION_WIPE: {
+						for (int32_t x = 0; x < 64; x++) {
+							map[x] = (x < p*2) ? -1 : int8_t(x);
+						}
+					} break;
+					case TRANSITION_SLIDE: {
+						for (int32_t x = 0; x < 64; x++) {
+							map[x] = (x + p*2 < 64) ? int8_t(x + p*2) : -1;
+						}
+					} break;
+					case TRANSITION_DISSOLVE: {
+						for (int32_t x = 0; x < 64; x++) {
+							map[x] = int8_t(x);
+						}
+						// 4x4 ordered dither, p/2 of the 16 levels are switched off
+						static const uint8_t bayer[16] = {
+							 0,  8,  2, 10,
+							12,  4, 14,  6,
+							 3, 11,  1,  9,
+							15,  7, 13,  5,
+						};
+						for (uint32_t c = 0; c < 4; c++) {
+							uint8_t m = 0;
+							for (uint32_t b = 0; b < 8; b++) {
+								if (bayer[c*4+(b&3)] >= uint32_t(p/2)) {
+									m |= 1 << b;
+								}
+							}
+							mask[c] = m;
+						}
+					} break;
+				}
+			}
+
+			// The top two pages as a ring of 64 columns, only the columns which
+			// scrolled in since the last call are fetched from the font.
+			void DisplayScrollMessage() {
+				uint32_t pos = (system_clock_ms - scroll_start_ms) / SCROLL_COLUMN_MS;
+				if (scroll_screen_valid && pos == scroll_screen_pos) {
 					return;
 				}
-				
-				(void)duck_font_raw_len;
-				
+
+				uint32_t from = pos;
+				if (scroll_ring_valid && (pos - scroll_ring_pos) < 64) {
+					from = scroll_ring_pos + 64;
+				}
+				for (uint32_t c = from; c < pos + 64; c++) {
+					uint32_t rx = c % (9 * 16);
+					uint32_t cx = rx >> 4;
+					// 16 pixel wide double height font, top half from glyph 0x200
+					uint16_t ch = 0x200 + scroll_message[cx] * 2 + ((rx >> 3) & 1);
+					uint8_t glyph[8];
+					duck_font_glyph(ch, glyph);
+					scroll_ring[0][c & 63] = glyph[rx & 7];
+					duck_font_glyph(ch + 0x100, glyph);
+					scroll_ring[1][c & 63] = glyph[rx & 7];
+				}
+				scroll_ring_pos = pos;
+				scroll_ring_valid = true;
+
+				// Unroll the ring so the leftmost visible column goes first
+				uint32_t head = pos & 63;
+				uint8_t buf[65];
+				buf[0] = 0x40;
+				memcpy(&buf[1], &scroll_ring[0][head], 64 - head);
+				memcpy(&buf[1 + 64 - head], &scroll_ring[0][0], head);
+
+				// The second line only makes sense after the window, so both
+				// are queued or neither is
+				if (!i2c_bus.Fits(3, 7 + 2 * 0x41) ||
+					!SendWindow(32, 95, 0, 1, buf, 0x41)) { // 0x20 offset
+					return;
+				}
+
+				// second line, the window wraps to it
+				memcpy(&buf[1], &scroll_ring[1][head], 64 - head);
+				memcpy(&buf[1 + 64 - head], &scroll_ring[1][0], head);
+				if (!Send(buf, 0x41)) {
+					return;
+				}
+
+				scroll_screen_pos = pos;
+				scroll_screen_valid = true;
+			}
+
+			// Every transition costs the same: 32 glyphs and 256 column lookups
+			void DisplayTransition() {
+				uint32_t start_us = micros();
+
+				transition_pending = false;
+
+				int8_t map[64];
+				uint8_t mask[4];
+				BuildTransition(map, mask);
+
+				// Rows after the first go to the window the first one opened,
+				// all four are queued or none is
+				if (!i2c_bus.Fits(5, 7 + 4 * 0x41)) {
+					transition_pending = true;
+					return;
+				}
+
+				uint8_t row[64];
 				uint8_t buf[65];
 				buf[0] = 0x40;
 				for (uint32_t y=0; y<4; y++) {
-					WriteCommand(0xB0+y);
-					uint32_t sx = 32;
-					WriteCommand(0x0f&(sx   )); // 0x20 offset
-					WriteCommand(0x10|(sx>>4)); // 0x20 offset
+					for (uint32_t c=0; c<8; c++) {
+						RenderChar(&row[c*8], text_buffer_screen[y*8+c], text_attr_screen[y*8+c]);
+					}
 					for (uint32_t x = 0; x < 64; x++) {
-						if (center_flip_screen == 32) {
-							buf[x+1] = 0x00;
-						} else {
-							int32_t rx = ( ( ( int32_t(x) - 32 ) * 32 ) / int32_t(32 - center_flip_screen) ) + 32;
-							if (rx < 0 || rx > 63) { 
-								buf[x+1] = 0x00;
-							} else {
-                                uint8_t a = text_attr_screen[y*8+rx/8];
-                                uint8_t r = (a & 4) ? (7-(rx&7)) : (rx&7);
-                                uint8_t v = duck_font_raw[text_buffer_screen[y*8+rx/8]*8+r];
-								if (a & 1) {
-									v = ~v;
-								}
-                                if (a & 2) {
-									v = rev_bits[v];
-								}
-                                buf[x+1] = v;
-							}
-						}
+						int32_t rx = map[x];
+						buf[x+1] = (rx < 0) ? 0x00 : (row[rx] & mask[x&3]);
 					}
-					Chip_I2C_MasterSend(I2C0, i2caddr, buf, 0x41);
-				} 
+					// The window wraps from one page to the next
+					bool sent = (y == 0) ? SendWindow(32, 95, 0, 3, buf, 0x41) : Send(buf, 0x41); // 0x20 offset
+					if (!sent) {
+						// Try the whole thing again next time
+						transition_pending = true;
+						break;
+					}
+				}
+
+				transition_us = micros() - start_us;
+				if (transition_us > transition_us_max) {
+					transition_us_max = transition_us;
+				}
 			}
 			
-			void DisplayChar(uint32_t x, uint32_t y, uint16_t ch, uint8_t attr) {
-				I2C_Guard guard;
-				if (guard.Check()) {
+			bool CellDirty(uint32_t x, uint32_t y) const {
+				return text_buffer_cache[y*8+x] != text_buffer_screen[y*8+x] ||
+					   text_attr_cache[y*8+x] != text_attr_screen[y*8+x];
+			}
+
+#ifdef ENABLE_ASSET_STORE
+			// Pulls the glyphs of all dirty cells into the asset cache in as
+			// few flash reads as possible before they get rendered.
+			void PrefetchGlyphs() {
+				uint16_t offsets[32];
+				uint32_t count = 0;
+				for (uint32_t c=0; c<32; c++) {
+					if (!CellDirty(c&7, c>>3)) {
+						continue;
+					}
+					uint32_t offset = duck_font_record(text_buffer_cache[c]);
+					if (offset != 0xFFFFFFFFUL) {
+						offsets[count++] = uint16_t(ASSET_FONT + offset);
+					}
+				}
+				AssetStore::Prefetch(offsets, count);
+			}
+#endif  // #ifdef ENABLE_ASSET_STORE
+
+			// Renders the 8 columns of a glyph into buf. The glyph is held
+			// as two words: attr 1 inverts, 2 flips vertically (bits in each
+			// column), 4 mirrors horizontally (column order).
+			void RenderChar(uint8_t *buf, uint16_t ch, uint8_t attr) {
+				uint32_t w[2];
+				if (attr == 0) {
+					duck_font_glyph(ch, buf);
 					return;
 				}
-				WriteCommand(0xB0+y);
-				x=x*8+32;
-				WriteCommand(0x0f&(x   )); // 0x20 offset
-				WriteCommand(0x10|(x>>4)); // 0x20 offset
-				
-				uint8_t buf[9];
-				buf[0] = 0x40;
-                if ((attr & 4)) {
-                    if ((attr & 1)) {
-                        if ((attr & 2)) {
-                            for (uint32_t c=0; c<8; c++) {
-                                buf[c+1] = ~rev_bits[duck_font_raw[ch*8+7-c]];
-                            }
-                        } else {
-                            for (uint32_t c=0; c<8; c++) {
-                                buf[c+1] = ~duck_font_raw[ch*8+7-c];
-                            }
-                        }
-                    } else {
-                        if ((attr & 2)) {
-                            for (uint32_t c=0; c<8; c++) {
-                                buf[c+1] =  rev_bits[duck_font_raw[ch*8+7-c]];
-                            }
-                        } else {
-                            for (uint32_t c=0; c<8; c++) {
-                                buf[c+1] =  duck_font_raw[ch*8+7-c];
-                            }
-                        }
-                    }
-                } else {
-                    if ((attr & 1)) {
-                        if ((attr & 2)) {
-                            for (uint32_t c=0; c<8; c++) {
-                                buf[c+1] = ~rev_bits[duck_font_raw[ch*8+c]];
-                            }
-                        } else {
-                            for (uint32_t c=0; c<8; c++) {
-                                buf[c+1] = ~duck_font_raw[ch*8+c];
-                            }
-                        }
-                    } else {
-                        if ((attr & 2)) {
-                            for (uint32_t c=0; c<8; c++) {
-                                buf[c+1] =  rev_bits[duck_font_raw[ch*8+c]];
-                            }
-                        } else {
-                            for (uint32_t c=0; c<8; c++) {
-                                buf[c+1] =  duck_font_raw[ch*8+c];
-                            }
-                        }
-                    }
-                }
-				Chip_I2C_MasterSend(I2C0, i2caddr, buf, 0x9);
-			}
-
-			void WriteCommand(uint8_t v) const {
-				I2C_Guard guard;
-				if (guard.Check()) {
+
+				// Menu highlights keep rendering the same few glyphs
+				uint32_t oldest = 0;
+				for (uint32_t c=0; c<GLYPH_CACHE_SIZE; c++) {
+					if (glyph_cache[c].ch == ch && glyph_cache[c].attr == attr) {
+						glyph_cache[c].used = ++glyph_cache_clock;
+						memcpy(buf, glyph_cache[c].w, 8);
+						glyph_cache_hits++;
+						return;
+					}
+					if (uint16_t(glyph_cache_clock - glyph_cache[c].used) >
+						uint16_t(glyph_cache_clock - glyph_cache[oldest].used)) {
+						oldest = c;
+					}
+				}
+				glyph_cache_misses++;
+
+				duck_font_glyph(ch, reinterpret_cast<uint8_t *>(w));
+				if ((attr & 2)) {
+					w[0] = rev_bits(w[0]);
+					w[1] = rev_bits(w[1]);
+				}
+				if ((attr & 4)) {
+					uint32_t t = __REV(w[0]);
+					w[0] = __REV(w[1]);
+					w[1] = t;
+				}
+				if ((attr & 1)) {
+					w[0] = ~w[0];
+					w[1] = ~w[1];
+				}
+				memcpy(buf, w, 8);
+
+				GlyphCacheEntry &entry = glyph_cache[oldest];
+				entry.w[0] = w[0];
+				entry.w[1] = w[1];
+				entry.ch = ch;
+				entry.attr = attr;
+				entry.used = ++glyph_cache_clock;
+			}
+
+			// Column and page address window followed by the data for it,
+			// needs horizontal addressing mode. Queued as a pair so the
+			// data goes out right after the window.
+			bool SendWindow(uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1, const uint8_t *buf, uint32_t len) {
+				uint8_t control[7];
+				control[0] = 0;
+				control[1] = 0x21;
+				control[2] = x0;
+				control[3] = x1;
+				control[4] = 0x22;
+				control[5] = y0;
+				control[6] = y1;
+				if (!i2c_bus.Write(i2caddr, control, 7, buf, len)) {
+					return false;
+				}
+				display_transactions += 2;
+				display_bytes += 7 + len;
+				return true;
+			}
+
+			bool Send(const uint8_t *buf, uint32_t len) {
+				if (!i2c_bus.Write(i2caddr, buf, len)) {
+					return false;
+				}
+				display_transactions++;
+				display_bytes += len;
+				return true;
+			}
+
+			// Display offset command and its argument in one transaction,
+			// a lone 0xD3 would take the next command as its argument
+			void SendVerticalShift() {
+				if (vertical_shift == vertical_shift_screen) {
 					return;
 				}
+				uint8_t control[3];
+				control[0] = 0;
+				control[1] = 0xD3;
+				control[2] = uint8_t(vertical_shift) & 0x3F;
+				if (Send(control, 3)) {
+					vertical_shift_screen = vertical_shift;
+				}
+			}
+
+			void WriteCommand(uint8_t v) {
 				uint8_t control[2];
 				control[0] = 0;
 				control[1] = v;
-				Chip_I2C_MasterSend(I2C0, i2caddr, control, 2);
+				i2c_bus.WriteWait(i2caddr, control, 2);
 			}
 
 
@@ -2233,8 +3619,24 @@ class SDD1306 {
 
 			bool devicePresent;
 
-			int8_t center_flip_screen;
-			int8_t center_flip_cache;
+			Transition transition_type;
+			int8_t transition_screen;
+			int8_t transition_cache;
+			bool transition_pending;
+			uint32_t transition_us;
+			uint32_t transition_us_max;
+
+			struct GlyphCacheEntry {
+				uint32_t w[2];
+				uint16_t ch;
+				uint8_t attr;
+				uint16_t used;
+			};
+
+			GlyphCacheEntry glyph_cache[GLYPH_CACHE_SIZE];
+			uint16_t glyph_cache_clock;
+			uint32_t glyph_cache_hits;
+			uint32_t glyph_cache_misses;
 			uint16_t text_buffer_cache[8*4];
 			uint16_t text_buffer_screen[8*4];
 			uint8_t text_attr_cache[8*4];
@@ -2242,41 +3644,45 @@ class SDD1306 {
 			
 			bool display_scroll_message;
 			uint8_t scroll_message[9];
-			int32_t scroll_message_offset;
+			uint32_t scroll_start_ms;
+			uint8_t scroll_ring[2][64];
+			uint32_t scroll_ring_pos;
+			bool scroll_ring_valid;
+			uint32_t scroll_screen_pos;
+			bool scroll_screen_valid;
+
+			uint32_t display_transactions;
+			uint32_t display_bytes;
+			uint32_t display_transactions_max;
+			uint32_t display_bytes_max;
+
+			int8_t vertical_shift;
+			int8_t vertical_shift_screen;
 };  // class SDD1306
 
 class Setup {
 
 	public:
             Setup(SDD1306 &sdd1306, BQ24295 &bq24295) {
+				// Timer first so the boot profile covers the rest of setup
+				InitTimer();
                 InitWWDT();
 				InitGPIO();
 				InitPININT();
 				InitADC();
 				InitI2C(sdd1306, bq24295);
-				InitTimer();
 			}
 
 			void ProbeI2CSlaves(SDD1306 &sdd1306, BQ24295 &bq24295) {
-				int i;
-				uint8_t ch[2];
+				// Only probe the addresses we actually talk to, a full
+				// bus scan of 0x08-0x78 costs several ms at boot.
+				uint8_t ch[1];
 
-				for (i = 0; i <= 0x7F; i++) {
-					if (!(i & 0x0F)) {
-					}
-					if ((i <= 7) || (i > 0x78)) {
-						continue;
-					}
-					if (Chip_I2C_MasterRead(I2C0, i, ch, 1 + (i == 0x48)) > 0) {
-						switch(i) {
-							case	sdd1306.i2caddr:
-									sdd1306.devicePresent = true;
-									break;
-							case	bq24295.i2caddr:
-									bq24295.devicePresent = true;
-									break;
-						}
-					}
+				if (i2c_bus.Transfer(sdd1306.i2caddr, 0, 0, ch, 1)) {
+					sdd1306.devicePresent = true;
+				}
+				if (i2c_bus.Transfer(bq24295.i2caddr, 0, 0, ch, 1)) {
+					bq24295.devicePresent = true;
 				}
 			}
 
@@ -2336,11 +3742,7 @@ class Setup {
 				Chip_IOCON_PinMuxSet(LPC_IOCON, 0, 4, IOCON_FUNC1 | I2C_FASTPLUS_BIT);
 				Chip_IOCON_PinMuxSet(LPC_IOCON, 0, 5, IOCON_FUNC1 | I2C_FASTPLUS_BIT);
 
-				Chip_I2C_Init(I2C0);
-				Chip_I2C_SetClockRate(I2C0, I2C_DEFAULT_SPEED);
-
-				NVIC_DisableIRQ(I2C0_IRQn);
-				Chip_I2C_SetMasterEventHandler(I2C0, Chip_I2C_EventHandlerPolling);
+				i2c_bus.Init(I2C_DEFAULT_SPEED, I2C_FASTPLUS_BIT);
 
 				ProbeI2CSlaves(sdd1306, bq24295);
 			}
@@ -3028,19 +4430,118 @@ class SX1280 {
 			//#define BLE_SUPPORT
 			#define RANGING_SUPPORT
 			#define LORA_SUPPORT
+			// Fixed length compact frames without the LoRa header, saves
+			// airtime on custom messages but can't receive v1 or v2 frames
+			//#define LORA_IMPLICIT_HEADER
 			
-			const uint32_t BUSY_PIN = 0x0118; // 1_24
+			static constexpr uint32_t BUSY_PIN = 0x0118; // 1_24
 			const uint32_t DIO1_PIN = 0x0006; // 0_6
 			const uint32_t RESET_PIN = 0x011C; // 1_28
 			
-			const uint32_t SPI_MOSI = 0x010D; // 1_13
-			const uint32_t SPI_MISO = 0x010E; // 1_14
-			const uint32_t SPI_SCLK = 0x0007; // 0_7
-			const uint32_t SPI_CSEL = 0x0011; // 0_17
+			static constexpr uint32_t SPI_MOSI = 0x010D; // 1_13
+			static constexpr uint32_t SPI_MISO = 0x010E; // 1_14
+			static constexpr uint32_t SPI_SCLK = 0x0007; // 0_7
+			static constexpr uint32_t SPI_CSEL = 0x0011; // 0_17
+
+			// BUSY stays up for ~1ms after a wakeup, anything longer means
+			// the radio is gone and we carry on rather than hang
+			#define RADIO_BUSY_TIMEOUT_US 10000
+			uint32_t busy_timeouts = 0;
 			
 			const uint32_t LORA_BUFFER_SIZE = 24;
 			uint8_t txBuffer[24] = { 0 };
-			uint8_t rxBuffer[24] = { 0 };
+
+			// Packets read out by Task(), waiting for ProcessPackets()
+			#define RADIO_RX_QUEUE_SIZE 4
+
+			struct Packet {
+				uint8_t data[24];
+				uint8_t size;
+				int8_t rssi;
+				int8_t snr;
+				uint32_t time_us;	// DIO1 edge which announced it
+			};
+
+			uint32_t rx_count = 0;
+			uint32_t rx_dropped = 0;
+			uint32_t rx_errors = 0;
+			uint32_t timeouts = 0;
+
+			#define RADIO_IRQ_POLL_MS 256
+			uint32_t missed_irqs = 0;
+
+			// v1 frames are "DUCK!!", 0, color, message[8], name[8]. v2 keeps
+			// color, message and name where they were, so the history reads
+			// both, and puts a header in front:
+			//   'D', 2, type << 4 | ttl, sender (le16), sequence (le16)
+			// Receivers relay a v2 frame with ttl left once, after a random
+			// delay so the relays of neighbours don't collide.
+			#define RADIO_V2_MAGIC 'D'
+			#define RADIO_V2_VERSION 2
+			#define RADIO_TYPE_MESSAGE 1
+			#define RADIO_TTL 2				// hops after the sender
+			#define RADIO_SEEN_SIZE 16		// power of two
+			#define RADIO_SEEN_MS 60000		// a relay comes within RADIO_RELAY_MAX_MS per hop
+			#define RADIO_RELAY_MIN_MS 100
+			#define RADIO_RELAY_MAX_MS 1500	// a few airtimes at SF11
+
+			// Listen before talk, every TX waits in tx_queue until a CAD
+			// finds the channel clear. A busy channel backs off a random
+			// time from a window which doubles per attempt. The random
+			// source is seeded with the sender id, so pendants which heard
+			// the same frame don't pick the same slots.
+			#define RADIO_TX_QUEUE_SIZE 4
+			#define RADIO_CAD_TRIES 8
+			#define RADIO_CAD_TIMEOUT_MS 200
+			#define RADIO_BACKOFF_SLOT_MS 50	// a 4 symbol CAD at SF11 and some
+			#define RADIO_BACKOFF_MAX_EXP 5
+
+			uint32_t cad_busy = 0;
+			uint32_t backoffs = 0;
+			uint32_t tx_dropped = 0;
+
+			// Sniff mode, settings.radio_sniff_ms > 0: the receiver sleeps
+			// that long between RX windows and every sender stretches its
+			// preamble over a whole sleep, so a receiver always wakes
+			// into one. Pendants only hear each other with the same
+			// setting, or a longer one on the sending side.
+			#define RADIO_SNIFF_RX_MS 50	// 5 symbols at SF11, enough to see a preamble
+
+			bool sniffing = false;
+			bool long_preamble = false;
+			// BUSY is high while the radio sleeps, sampled every ms
+			uint32_t radio_ms = 0;
+			uint32_t radio_on_ms = 0;
+
+			// Compact frame, what SendMessage() sends when the text fits:
+			//   1 P TT CCCC, sender (le16), sequence (low byte), TX dBm,
+			//   name (6 bit packed), P ? preset index : message (6 bit packed)
+			// P marks a built-in message, TT is the ttl and CCCC the color.
+			// 12 bytes with a preset and 17 with a custom message, the same
+			// number of symbols as without the power byte.
+			#define RADIO_COMPACT 0x80
+			#define RADIO_COMPACT_PRESET 0x40
+			#define RADIO_COMPACT_SIZE 17
+
+			// TX power from the path loss to the pendants heard directly, the
+			// weakest one still gets RADIO_MARGIN_DB over the sensitivity.
+			// Every RADIO_PROBE_EVERY message goes out at full power so the
+			// ones further out can show up again.
+			#define RADIO_NEIGHBORS 8
+			#define RADIO_NEIGHBOR_MS (10*60*1000)	// forgotten after
+			#define RADIO_SENSITIVITY_DBM -125		// SF11 BW200, with some slack
+			#define RADIO_MARGIN_DB 10
+			#define RADIO_POWER_MIN -18
+			#define RADIO_PROBE_EVERY 8
+
+			int8_t tx_power = 13;	// our own messages, relays go at TX_OUTPUT_POWER
+
+			uint16_t sender_id = 0;
+			uint32_t duplicates = 0;
+			uint32_t relayed = 0;
+
+			uint32_t last_airtime_us = 0;
+			uint32_t tx_airtime_ms = 0;
 			
 			const uint32_t RF_FREQUENCY = 2425000000UL;
 			const uint32_t TX_OUTPUT_POWER = 13;
@@ -3049,7 +4550,7 @@ class SX1280 {
 			const uint16_t RX_TIMEOUT_VALUE = 0xffff; // ms
 			const RadioTickSizes RX_TIMEOUT_TICK_SIZE = RADIO_TICK_SIZE_1000_US;
 
-			const uint16_t IrqMask = IRQ_TX_DONE | IRQ_RX_DONE | IRQ_RX_TX_TIMEOUT;
+			const uint16_t IrqMask = IRQ_TX_DONE | IRQ_RX_DONE | IRQ_RX_TX_TIMEOUT | IRQ_CAD_DONE | IRQ_CAD_DETECTED;
 
 			// Standard values
 
@@ -3066,10 +4567,26 @@ class SX1280 {
 			SX1280(SDD1306 &_sdd1306, EEPROM &_settings, FT25H16S &_ft25h16s):
 				sdd1306(_sdd1306),
 				settings(_settings),
-				ft25h16s(_ft25h16s) { 
+				ft25h16s(_ft25h16s),
+				random(0) { 
 			}
 			
-			void Init(bool pollMode) {
+			void Init(bool pollMode, bool warm = false) {
+				// Fold the chip UID into the sender id, 0 marks a free dedupe slot
+				unsigned int param[1] = { 0 };
+				param[0] = 58; // Read UID
+				unsigned int result[5] = { 0 };
+				iap_entry(param, result);
+				uint32_t hash = 0x811C9DC5UL;
+				for (uint32_t c=1; c<5; c++) {
+					hash = (hash ^ result[c]) * 0x01000193UL;
+				}
+				sender_id = uint16_t(hash ^ (hash >> 16));
+				if (sender_id == 0) {
+					sender_id = 1;
+				}
+				random = Random(hash);
+
 				// Configure control pins
 				Chip_IOCON_PinMuxSet(LPC_IOCON, (RESET_PIN>>8), (RESET_PIN&0xFF), IOCON_FUNC0 | IOCON_MODE_PULLUP);
 				Chip_GPIO_SetPinDIROutput(LPC_GPIO, (RESET_PIN>>8), (RESET_PIN&0xFF));
@@ -3095,7 +4612,11 @@ class SX1280 {
 				Chip_GPIO_SetPinOutHigh(LPC_GPIO, (SPI_CSEL>>8), (SPI_CSEL&0xFF));
 				Chip_GPIO_SetPinOutLow(LPC_GPIO, (SPI_SCLK>>8), (SPI_SCLK&0xFF));
 
-				Reset();
+				// After a MCU-only reset the radio is still configured, only
+				// pay for the hardware reset if it looks stuck.
+				if (!warm || Chip_GPIO_GetPinState(LPC_GPIO, uint8_t(BUSY_PIN>>8), uint8_t(BUSY_PIN&0xFF))) {
+					Reset();
+				}
 
 				if (!pollMode) {
 					Chip_IOCON_PinMuxSet(LPC_IOCON, uint8_t(DIO1_PIN>>8), uint8_t(DIO1_PIN&0xFF), IOCON_FUNC0 | IOCON_MODE_PULLUP);
@@ -3119,29 +4640,172 @@ class SX1280 {
 				modulationParams.PacketType                  = PACKET_TYPE_LORA;
 				modulationParams.Params.LoRa.SpreadingFactor = LORA_SF11;
 				modulationParams.Params.LoRa.Bandwidth       = LORA_BW_0200;
-				modulationParams.Params.LoRa.CodingRate      = LORA_CR_LI_4_7;
+				modulationParams.Params.LoRa.CodingRate      = LORA_CR_4_5;
 				SetPacketType( modulationParams.PacketType );
 				SetModulationParams( &modulationParams );
 
 				PacketParams PacketParams;
 				PacketParams.PacketType                 	 = PACKET_TYPE_LORA;
-				PacketParams.Params.LoRa.PreambleLength      = 0x0C;
+				PacketParams.Params.LoRa.PreambleLength      = PreambleFor( settings.radio_sniff_ms );
+#ifdef LORA_IMPLICIT_HEADER
+				PacketParams.Params.LoRa.HeaderType          = LORA_PACKET_FIXED_LENGTH;
+#else  // #ifdef LORA_IMPLICIT_HEADER
 				PacketParams.Params.LoRa.HeaderType          = LORA_PACKET_VARIABLE_LENGTH;
-				PacketParams.Params.LoRa.PayloadLength       = LORA_BUFFER_SIZE;
+#endif  // #ifdef LORA_IMPLICIT_HEADER
+				PacketParams.Params.LoRa.PayloadLength       = RxPayloadLength();
 				PacketParams.Params.LoRa.Crc                 = LORA_CRC_ON;
 				PacketParams.Params.LoRa.InvertIQ            = LORA_IQ_NORMAL;
 				SetPacketParams( &PacketParams );
 				
 				SetRfFrequency( RF_FREQUENCY );
 				SetBufferBaseAddresses( 0x00, 0x00 );
-				SetTxParams( TX_OUTPUT_POWER, RADIO_RAMP_20_US );
+				tx_power = int8_t(TX_OUTPUT_POWER);
+				SetTxParams( tx_power, RADIO_RAMP_20_US );
 				SetDioIrqParams( SX1280::IrqMask, SX1280::IrqMask, IRQ_RADIO_NONE, IRQ_RADIO_NONE );
 				
-		    	SetRx( TickTime { RX_TIMEOUT_TICK_SIZE, RX_TIMEOUT_VALUE } );
+				device_present = GetFirmwareVersion() == 0x0000a9b5;
+
+				sniffing = false;
+				long_preamble = settings.radio_sniff_ms != 0;
+				SetLongPreamble( long_preamble );
+				Listen();
+			}
+
+			// What the radio was last told, RxPayloadLength() while listening
+			uint8_t RxLength() const {
+				return LoRaPacketParams.Params.LoRa.PayloadLength;
+			}
+
+			// Largest payload RX takes, with the LoRa header as well
+			uint8_t RxPayloadLength() const {
+#ifdef LORA_IMPLICIT_HEADER
+				return RADIO_COMPACT_SIZE;
+#else  // #ifdef LORA_IMPLICIT_HEADER
+				return uint8_t(LORA_BUFFER_SIZE);
+#endif  // #ifdef LORA_IMPLICIT_HEADER
+			}
+
+			// Back to receiving, all the time or duty cycled
+			void Listen() {
+				// SendBuffer() leaves the TX length in the packet parameters,
+				// RX would drop anything longer than the last frame we sent
+				if (LoRaPacketParams.Params.LoRa.PayloadLength != RxPayloadLength()) {
+					LoRaPacketParams.Params.LoRa.PayloadLength = RxPayloadLength();
+					SetPacketParams( &LoRaPacketParams );
+				}
+				// Keeps an RX window open once it caught a preamble
+				if (long_preamble != (settings.radio_sniff_ms != 0)) {
+					long_preamble = settings.radio_sniff_ms != 0;
+					SetLongPreamble( long_preamble );
+				}
+				if (settings.radio_sniff_ms) {
+					ClearIrqStatus( IRQ_RADIO_ALL );
+					SetRxDutyCycle( RADIO_TICK_SIZE_1000_US, RADIO_SNIFF_RX_MS, uint16_t(settings.radio_sniff_ms) );
+					sniffing = true;
+				} else {
+					SetRx( TickTime { RX_TIMEOUT_TICK_SIZE, RX_TIMEOUT_VALUE } );
+				}
+			}
+
+			// A sleeping radio holds BUSY high until an NSS edge wakes it.
+			// Awake inside an RX window it would go back to sleep when the
+			// window closes, the standby ends the duty cycle either way.
+			// OperatingMode stays, ProcessIrqs() reads the IRQs by it.
+			// Listen() again when done.
+			void WakeFromSniff() {
+				if (sniffing) {
+					sniffing = false;
+					Wakeup();
+					RadioOperatingModes mode = OperatingMode;
+					SetStandby( STDBY_RC );
+					OperatingMode = mode;
+				}
+			}
+
+			// Takes a new sniff setting, the preamble follows with the next TX
+			void SetSniff(uint32_t sleep_ms) {
+				settings.radio_sniff_ms = sleep_ms;
+				// A TX or a CAD in flight picks it up when it is done
+				if (OperatingMode == MODE_RX) {
+					WakeFromSniff();
+					Listen();
+				}
+				radio_ms = 0;
+				radio_on_ms = 0;
+			}
+
+			// Radio not asleep, in 1/1000
+			uint32_t RadioOnPermille() const {
+				return radio_ms ? (radio_on_ms * 1000) / radio_ms : 0;
+			}
+
+			// What the stretched preamble adds to the time on air and so to
+			// the delivery of every message
+			uint32_t SniffLatencyMs() {
+				uint8_t p = PreambleFor(settings.radio_sniff_ms);
+				return ((uint32_t(p & 0x0F) << (p >> 4)) - 8) * SymbolUs() / 1000;
 			}
 			
-			void SendBuffer() {
-				SendPayload( txBuffer, LORA_BUFFER_SIZE, TickTime { RX_TIMEOUT_TICK_SIZE, TX_TIMEOUT_VALUE } ); 
+			void SendBuffer(uint8_t size, int8_t power) {
+				if (power != LoRaTxPower) {
+					SetTxParams( power, RADIO_RAMP_20_US );
+				}
+				// The length of a TX comes from the packet parameters
+				uint8_t preamble = PreambleFor(settings.radio_sniff_ms);
+				if (LoRaPacketParams.Params.LoRa.PayloadLength != size ||
+					LoRaPacketParams.Params.LoRa.PreambleLength != preamble) {
+					LoRaPacketParams.Params.LoRa.PayloadLength = size;
+					LoRaPacketParams.Params.LoRa.PreambleLength = preamble;
+					SetPacketParams( &LoRaPacketParams );
+				}
+				last_airtime_us = AirtimeUs(size);
+				tx_airtime_ms += last_airtime_us / 1000;
+				// A sniff preamble alone can be longer than TX_TIMEOUT_VALUE
+				uint16_t timeout = uint16_t(TX_TIMEOUT_VALUE + last_airtime_us / 1000);
+				SendPayload( txBuffer, size, TickTime { RX_TIMEOUT_TICK_SIZE, timeout } ); 
+			}
+
+			// LoRa time on air of size payload bytes with the current
+			// parameters, after the SX1280 datasheet. Counted in quarter
+			// symbols for the 4.25 sync symbols.
+			uint32_t AirtimeUs(uint32_t size) {
+				uint32_t sf = LoRaSpreadingFactor >> 4;
+				uint32_t cr = LoRaCodingRate;
+				// Long interleaving 4/5, 4/6 and 4/8 (named LI_4_7)
+				if (cr > LORA_CR_4_8) {
+					cr = (cr == LORA_CR_LI_4_7) ? 4 : cr - 4;
+				}
+				uint8_t p = LoRaPacketParams.Params.LoRa.PreambleLength;
+				uint32_t preamble = (p & 0x0F) << (p >> 4);
+				int32_t bits = int32_t(8 * size) - int32_t(4 * sf) +
+							   (LoRaPacketParams.Params.LoRa.Crc == LORA_CRC_ON ? 16 : 0) +
+							   (sf >= 7 ? 8 : 0) +
+							   (LoRaPacketParams.Params.LoRa.HeaderType == LORA_PACKET_VARIABLE_LENGTH ? 20 : 0);
+				uint32_t per_block = 4 * (sf >= 11 ? sf - 2 : sf);
+				uint32_t blocks = bits > 0 ? (uint32_t(bits) + per_block - 1) / per_block : 0;
+				uint32_t quarters = (preamble + 8 + blocks * (cr + 4)) * 4 + (sf >= 7 ? 17 : 25);
+				// All bandwidths are multiples of 15625Hz
+				return ((quarters << sf) * 16) / (uint32_t(GetLoRaBandwidth()) / 15625);
+			}
+
+			uint32_t SymbolUs() {
+				uint32_t sf = LoRaSpreadingFactor >> 4;
+				return (64UL << sf) / (uint32_t(GetLoRaBandwidth()) / 15625);
+			}
+
+			// Preamble parameter, mantissa | exponent << 4, which covers a
+			// sleep of sleep_ms plus the RX window and leaves the 8 symbols
+			// a receiver locks on
+			uint8_t PreambleFor(uint32_t sleep_ms) {
+				if (!sleep_ms) {
+					return 0x08;
+				}
+				uint32_t symbols = ((sleep_ms + RADIO_SNIFF_RX_MS) * 1000) / SymbolUs() + 8;
+				uint32_t exp = 0;
+				while (((symbols + (1UL << exp) - 1) >> exp) > 15) {
+					exp++;
+				}
+				return uint8_t((exp << 4) | ((symbols + (1UL << exp) - 1) >> exp));
 			}
 			
 			void Reset() {
@@ -3173,8 +4837,10 @@ class SX1280 {
 				enableIRQ( );
 			}
 			
-			bool DevicePresent()  {
-				return GetFirmwareVersion() == 0x0000a9b5;
+			// Probed once by Init(), the UI asks from the main loop where it
+			// must not touch the SPI
+			bool DevicePresent() const {
+				return device_present;
 			}
 
 			uint16_t GetFirmwareVersion( void )
@@ -3192,8 +4858,19 @@ class SX1280 {
 				return( status );
 			}
 
-			void WaitOnBusy() {
-				while ( Chip_GPIO_GetPinState(LPC_GPIO, uint8_t(BUSY_PIN>>8), uint8_t(BUSY_PIN&0xFF)) == 1) { };
+			bool WaitOnBusy() {
+				volatile uint8_t &busy = LPC_GPIO->B[BUSY_PIN>>8][BUSY_PIN&0xFF];
+				if (!busy) {
+					return true;
+				}
+				uint32_t start = micros();
+				while (busy) {
+					if ((micros() - start) > RADIO_BUSY_TIMEOUT_US) {
+						busy_timeouts++;
+						return false;
+					}
+				}
+				return true;
 			}
 			
 			void WriteCommand(RadioCommand command, uint8_t *buffer, uint32_t size) {
@@ -3201,9 +4878,7 @@ class SX1280 {
 
 				Chip_GPIO_SetPinOutLow(LPC_GPIO, (SPI_CSEL>>8), (SPI_CSEL&0xFF));
 				spiwrite( ( uint8_t )command );
-				for( uint16_t i = 0; i < size; i++ ) {
-					spiwrite( buffer[i] );
-				}
+				spitransfer( buffer, 0, size );
 				Chip_GPIO_SetPinOutHigh(LPC_GPIO, (SPI_CSEL>>8), (SPI_CSEL&0xFF));
 			
 				if( command != RADIO_SET_SLEEP ) {
@@ -3220,12 +4895,9 @@ class SX1280 {
 					spiwrite( 0 );
 					spiwrite( 0 );
 				} else {
-					spiwrite( ( uint8_t )command );
-					spiwrite( 0 );
-					for( uint16_t i = 0; i < size; i++ )
-					{
-						 buffer[i] = spiwrite( 0 );
-					}
+					uint8_t header[2] = { ( uint8_t )command, 0 };
+					spitransfer( header, 0, 2 );
+					spitransfer( 0, buffer, size );
 				}
 				Chip_GPIO_SetPinOutHigh(LPC_GPIO, (SPI_CSEL>>8), (SPI_CSEL&0xFF));
 
@@ -3236,12 +4908,9 @@ class SX1280 {
 				WaitOnBusy( );
 
 				Chip_GPIO_SetPinOutLow(LPC_GPIO, (SPI_CSEL>>8), (SPI_CSEL&0xFF));
-				spiwrite( RADIO_WRITE_REGISTER );
-				spiwrite( ( address & 0xFF00 ) >> 8 );
-				spiwrite( address & 0x00FF );
-				for( uint16_t i = 0; i < size; i++ ) {
-					spiwrite( buffer[i] );
-				}
+				uint8_t header[3] = { RADIO_WRITE_REGISTER, uint8_t( ( address & 0xFF00 ) >> 8 ), uint8_t( address & 0x00FF ) };
+				spitransfer( header, 0, 3 );
+				spitransfer( buffer, 0, size );
 				Chip_GPIO_SetPinOutHigh(LPC_GPIO, (SPI_CSEL>>8), (SPI_CSEL&0xFF));
 
 				WaitOnBusy( );
@@ -3255,13 +4924,9 @@ class SX1280 {
 				WaitOnBusy( );
 
 				Chip_GPIO_SetPinOutLow(LPC_GPIO, (SPI_CSEL>>8), (SPI_CSEL&0xFF));
-				spiwrite( RADIO_READ_REGISTER );
-				spiwrite( ( address & 0xFF00 ) >> 8 );
-				spiwrite( address & 0x00FF );
-				spiwrite( 0 );
-				for( uint16_t i = 0; i < size; i++ ) {
-					buffer[i] = spiwrite( 0 );
-				}
+				uint8_t header[4] = { RADIO_READ_REGISTER, uint8_t( ( address & 0xFF00 ) >> 8 ), uint8_t( address & 0x00FF ), 0 };
+				spitransfer( header, 0, 4 );
+				spitransfer( 0, buffer, size );
 				Chip_GPIO_SetPinOutHigh(LPC_GPIO, (SPI_CSEL>>8), (SPI_CSEL&0xFF));
 
 				WaitOnBusy( );
@@ -3277,11 +4942,9 @@ class SX1280 {
 			    WaitOnBusy( );
 
 				Chip_GPIO_SetPinOutLow(LPC_GPIO, (SPI_CSEL>>8), (SPI_CSEL&0xFF));
-				spiwrite( RADIO_WRITE_BUFFER );
-				spiwrite( offset );
-				for( uint16_t i = 0; i < size; i++ ) {
-					spiwrite( buffer[i] );
-				}
+				uint8_t header[2] = { RADIO_WRITE_BUFFER, offset };
+				spitransfer( header, 0, 2 );
+				spitransfer( buffer, 0, size );
 				Chip_GPIO_SetPinOutHigh(LPC_GPIO, (SPI_CSEL>>8), (SPI_CSEL&0xFF));
 
 				WaitOnBusy( );
@@ -3291,17 +4954,42 @@ class SX1280 {
 			    WaitOnBusy( );
 
 				Chip_GPIO_SetPinOutLow(LPC_GPIO, (SPI_CSEL>>8), (SPI_CSEL&0xFF));
-				spiwrite( RADIO_READ_BUFFER );
-				spiwrite( offset );
-				spiwrite( 0 );
-				for( uint16_t i = 0; i < size; i++ ) {
-					buffer[i] = spiwrite( 0 );
-				}
+				uint8_t header[3] = { RADIO_READ_BUFFER, offset, 0 };
+				spitransfer( header, 0, 3 );
+				spitransfer( 0, buffer, size );
 				Chip_GPIO_SetPinOutHigh(LPC_GPIO, (SPI_CSEL>>8), (SPI_CSEL&0xFF));
 
 				WaitOnBusy( );
 			}
 
+			// Payload bytes per ms of a full LORA_BUFFER_SIZE ReadBuffer(),
+			// for '@RADIO'. The profiler build also times the old GPIO call
+			// per pin transport as the reference.
+			uint32_t TransportBytesPerMs(bool reference = false) {
+				uint8_t buf[24];
+				bool sniff = sniffing;
+				WakeFromSniff();
+				disableIRQ();
+				uint32_t start = micros();
+				for (uint32_t c=0; c<16; c++) {
+#ifdef ENABLE_PROFILER
+					if (reference) {
+						ReadBufferReference( 0, buf, LORA_BUFFER_SIZE );
+						continue;
+					}
+#else  // #ifdef ENABLE_PROFILER
+					(void)reference;
+#endif  // #ifdef ENABLE_PROFILER
+					ReadBuffer( 0, buf, LORA_BUFFER_SIZE );
+				}
+				uint32_t us = micros() - start;
+				enableIRQ();
+				if (sniff) {
+					Listen();
+				}
+				return us ? (16 * LORA_BUFFER_SIZE * 1000) / us : 0;
+			}
+
 
 			void SetSleep( SleepParams sleepConfig ) {
 				uint8_t sleep = ( sleepConfig.WakeUpRTC << 3 ) |
@@ -3440,6 +5128,7 @@ class SX1280 {
 				buf[0] = power + 18;
 				buf[1] = ( uint8_t )rampTime;
 				WriteCommand( RADIO_SET_TXPARAMS, buf, 2 );
+				LoRaTxPower = power;
 			}
 
 			void SetCadParams( RadioLoRaCadSymbols cadSymbolNum ) {
@@ -3481,6 +5170,8 @@ class SX1280 {
 						buf[1] = modParams->Params.LoRa.Bandwidth;
 						buf[2] = modParams->Params.LoRa.CodingRate;
 						LoRaBandwidth = modParams->Params.LoRa.Bandwidth;
+						LoRaSpreadingFactor = modParams->Params.LoRa.SpreadingFactor;
+						LoRaCodingRate = modParams->Params.LoRa.CodingRate;
 						break;
 				#endif  // #if defined(LORA_SUPPORT) || defined(RANGING_SUPPORT)
 				#ifdef FLRC_SUPPORT
@@ -3539,6 +5230,7 @@ class SX1280 {
 						buf[4] = packetParams->Params.LoRa.InvertIQ;
 						buf[5] = 0;
 						buf[6] = 0;
+						LoRaPacketParams = *packetParams;
 						break;
 				#endif  // #if defined(LORA_SUPPORT) || defined(RANGING_SUPPORT)
 				#ifdef FLRC_SUPPORT
@@ -4094,31 +5786,161 @@ class SX1280 {
 				PollingMode = false;
 			}
 
+			/*
+			 * Only notes the edge in either mode, the SPI traffic and what
+			 * follows from it is left to Task( ) in the main loop.
+			 */
 			void OnDioIrq( void ) {
-				/*
-				 * When polling mode is activated, it is up to the application to call
-				 * ProcessIrqs( ). Otherwise, the driver automatically calls ProcessIrqs( )
-				 * on radio interrupt.
-				 */
-				if( PollingMode == true ) {
-					IrqState = true;
-				} else {
-					ProcessIrqs( );
+				if( IrqState == false ) {
+					irq_time_us = micros();
+				}
+				IrqState = true;
+			}
+
+			// Main loop half of the radio. SysTick is the only other user of
+			// the SPI, so only its interrupt is held off for the transfers;
+			// with a radio which keeps BUSY up they can take tens of ms and
+			// the UART, I2C, buttons and profiler carry on meanwhile. A tick
+			// which came due is made pending again, the ms clock loses only
+			// the ones beyond the first.
+			void Task( void ) {
+				// Backstop for a lost DIO1 edge, the line stays high as long
+				// as an IRQ is pending in the radio
+				if( IrqState == false && ( system_clock_ms - irq_poll_ms ) >= RADIO_IRQ_POLL_MS ) {
+					irq_poll_ms = system_clock_ms;
+					if( Chip_GPIO_GetPinState( LPC_GPIO, ( DIO1_PIN>>8 ), ( DIO1_PIN&0xFF ) ) ) {
+						missed_irqs++;
+						irq_time_us = micros();
+						IrqState = true;
+					}
+				}
+				if( IrqState == false ) {
+					return;
+				}
+				SysTick->CTRL &= ~SysTick_CTRL_TICKINT_Msk;
+				IrqState = false;
+				ProcessIrqs( );
+				uint32_t ctrl = SysTick->CTRL;
+				if( ( ctrl & SysTick_CTRL_COUNTFLAG_Msk ) ) {
+					SCB->ICSR = SCB_ICSR_PENDSTSET_Msk;
+				}
+				SysTick->CTRL = ctrl | SysTick_CTRL_TICKINT_Msk;
+			}
+
+			// SysTick half, persists the queued packets and flags them for
+			// the UI, in the same context as every other settings write.
+			void ProcessPackets() {
+				if (radio_ms >= (1UL << 22)) {
+					radio_ms >>= 1;
+					radio_on_ms >>= 1;
+				}
+				radio_ms++;
+				if (!LPC_GPIO->B[BUSY_PIN>>8][BUSY_PIN&0xFF]) {
+					radio_on_ms++;
+				}
+				while (rx_tail != rx_head) {
+					const Packet &packet = rx_queue[rx_tail % RADIO_RX_QUEUE_SIZE];
+					// Everything below works on the v2 layout
+					uint8_t frame[24];
+					const uint8_t *data = packet.data;
+					if ((data[0] & RADIO_COMPACT) && Expand(packet.data, packet.size, frame)) {
+						data = frame;
+					}
+					bool message = false;
+					if (memcmp(data,"DUCK!!",6) == 0) {
+						// v1, nothing to dedupe or relay
+						message = true;
+					} else if (data[0] == RADIO_V2_MAGIC && data[1] == RADIO_V2_VERSION) {
+						uint16_t sender = uint16_t(data[3] | (data[4] << 8));
+						uint16_t seq = uint16_t(data[5] | (data[6] << 8));
+						// A relay would measure the relaying pendant, v2 frames
+						// don't say their power and count as sent at full
+						if (sender != sender_id && (data[2] & 0x0F) == RADIO_TTL) {
+							UpdateNeighbor(sender, data == frame ? int8_t(packet.data[4]) : int8_t(TX_OUTPUT_POWER), packet);
+						}
+						if (sender == sender_id || Seen(sender, uint8_t(seq))) {
+							duplicates++;
+						} else {
+							message = (data[2] >> 4) == RADIO_TYPE_MESSAGE;
+							// Relays leave a slot free for our own messages
+							if ((data[2] & 0x0F) && TxQueueFree() > 1 && settings.radio_enabled) {
+								// Passed on as it came in, one hop less
+								uint8_t relay[24];
+								memcpy(relay, packet.data, packet.size);
+								if (data != frame) {
+									relay[2]--;
+								} else {
+									relay[0] -= 0x10;
+								}
+								// At full power, a relay is for the pendants beyond
+								// the ones our own messages are sized for
+								if (Queue(relay, packet.size, random.get(RADIO_RELAY_MIN_MS, RADIO_RELAY_MAX_MS), int8_t(TX_OUTPUT_POWER))) {
+									relayed++;
+								}
+							}
+						}
+					}
+					if (message) {
+						memcpy(settings.recv_radio_message, data+8, 8);
+						memcpy(settings.recv_radio_name, data+16, 8);
+						settings.recv_radio_color = data[7];
+						if (settings.radio_enabled) {
+							settings.recv_radio_message_pending = true;
+							settings.UpdateRecvCount();
+							settings.RecordMessage(ft25h16s, data);
+						}
+						ui_invalid |= UI_INVALID_RADIO;
+					}
+					rx_tail = uint8_t(rx_tail + 1);
+				}
+				// One CAD at a time and only from listening, a TX or a CAD
+				// in flight finishes first. cadDone() takes it from there.
+				if (tx_tail != tx_head) {
+					if (OperatingMode == MODE_CAD) {
+						if ((system_clock_ms - cad_start_ms) > RADIO_CAD_TIMEOUT_MS) {
+							timeouts++;
+							Listen();
+						}
+					} else if (OperatingMode == MODE_RX && !IrqState &&
+							   int32_t(system_clock_ms - tx_queue[tx_tail % RADIO_TX_QUEUE_SIZE].due_ms) >= 0) {
+						cad_start_ms = system_clock_ms;
+						WakeFromSniff();
+						SetCadParams( LORA_CAD_04_SYMBOLS );
+						SetCad( );
+					}
+				}
+			}
+
+			uint32_t TxQueueFree() const {
+				return RADIO_TX_QUEUE_SIZE - uint8_t(tx_head - tx_tail);
+			}
+
+			// Holds a frame for the next clear channel after delay_ms, sent
+			// at power dBm
+			bool Queue(const uint8_t *frame, uint8_t size, uint32_t delay_ms, int8_t power) {
+				if (!TxQueueFree()) {
+					tx_dropped++;
+					return false;
 				}
+				Outgoing &out = tx_queue[tx_head % RADIO_TX_QUEUE_SIZE];
+				memcpy(out.data, frame, size);
+				out.size = size;
+				out.power = power;
+				out.tries = 0;
+				out.due_ms = system_clock_ms + delay_ms;
+				tx_head = uint8_t(tx_head + 1);
+				return true;
 			}
 
 			void ProcessIrqs( void ) {
 				RadioPacketTypes packetType = PACKET_TYPE_NONE;
 
-				if( PollingMode == true ) {
-					if( IrqState == true ) {
-			            disableIRQ( );
-						IrqState = false;
-			            enableIRQ( );
-					} else {
-						return;
-					}
-				}
+				Trace::Begin(Trace::RADIO_PROCESS);
+
+				// A duty cycled receive may have gone back to sleep after
+				// the packet, pick it up awake and restart the cycle below
+				bool sniff = sniffing;
+				WakeFromSniff();
 
 				packetType = GetPacketType( true );
 				uint16_t irqRegs = GetIrqStatus( );
@@ -4295,63 +6117,56 @@ class SX1280 {
 						// Unexpected IRQ: silently returns
 						break;
 				}
+
+				if (sniff && OperatingMode == MODE_RX && !sniffing) {
+					Listen();
+				}
+
+				Trace::End(Trace::RADIO_PROCESS, irqRegs);
 			}
 
 			void txDone() {
-				//sdd1306.PlaceAsciiStr(0,0,"TXDONE!!");
-				//sdd1306.Display();
-				//delay(250);
-		    	SetRx( TickTime { RX_TIMEOUT_TICK_SIZE, RX_TIMEOUT_VALUE } );
+		    	Listen();
 			}
 
 			void rxDone() {
-				//sdd1306.PlaceAsciiStr(0,0,"RXDONE!!");
-				//sdd1306.Display();
-				//delay(250);
+				Trace::Begin(Trace::RX_DONE);
+				rx_count++;
+				if (uint8_t(rx_head - rx_tail) >= RADIO_RX_QUEUE_SIZE) {
+					rx_dropped++;
+					Trace::End(Trace::RX_DONE, 0);
+					return;
+				}
 			    PacketStatus packetStatus;
 				GetPacketStatus(&packetStatus);
-				uint8_t rxBufferSize = 0;
-                GetPayload( rxBuffer, &rxBufferSize, LORA_BUFFER_SIZE );
-				if (memcmp(rxBuffer,"DUCK!!",6) == 0) {
-					memcpy(settings.recv_radio_message, rxBuffer+8, 8);
-					memcpy(settings.recv_radio_name, rxBuffer+16, 8);
-					settings.recv_radio_color = rxBuffer[7];
-					if (settings.radio_enabled) {
-						settings.recv_radio_message_pending = true;
-						settings.UpdateRecvCount();
-						settings.RecordMessage(ft25h16s, rxBuffer);
-					}
-				}
+				Packet &packet = rx_queue[rx_head % RADIO_RX_QUEUE_SIZE];
+				packet.size = 0;
+                GetPayload( packet.data, &packet.size, LORA_BUFFER_SIZE );
+				packet.rssi = packetStatus.LoRa.RssiPkt;
+				packet.snr = packetStatus.LoRa.SnrPkt;
+				packet.time_us = irq_time_us;
+				rx_head = uint8_t(rx_head + 1);
+				Trace::End(Trace::RX_DONE, packet.size);
 			}
 
 			void rxSyncWordDone() {
-				sdd1306.PlaceAsciiStr(0,0,"RXSYNCDO");
-				sdd1306.Display();
-				delay(250);
 			}
 
 			void rxHeaderDone() {
-				sdd1306.PlaceAsciiStr(0,0,"RXHEADER");
-				sdd1306.Display();
-				delay(250);
 			}
 			
+			// The radio drops to standby, go back to listening
 			void txTimeout() {
-				sdd1306.PlaceAsciiStr(0,0,"TXTIMOUT");
-				sdd1306.Display();
-				delay(250);
+				timeouts++;
+		    	Listen();
 			}
 			
 			void rxTimeout() {
-				sdd1306.PlaceAsciiStr(0,0,"RXTIMOUT");
-				sdd1306.Display();
-				delay(250);
+				timeouts++;
 			}
 			
 			void rxError(IrqErrorCode errCode) {
-				sdd1306.PlaceAsciiStr(0,0,"RXERROR!");
-				sdd1306.Display();
-				delay(250);
+				rx_errors++;
 			}
 
 			void rangingDone(IrqRangingCode errCode) {
@@ -4359,20 +6174,67 @@ class SX1280 {
 			}
 
 			void cadDone(bool cadFlag) {
-				// TODO
+				if (tx_tail == tx_head) {
+			    	Listen();
+					return;
+				}
+				Outgoing &out = tx_queue[tx_tail % RADIO_TX_QUEUE_SIZE];
+				if (!cadFlag) {
+					memcpy(txBuffer, out.data, out.size);
+					tx_tail = uint8_t(tx_tail + 1);
+					SendBuffer(out.size, out.power);
+					return;
+				}
+				cad_busy++;
+				out.tries++;
+				if (out.tries >= RADIO_CAD_TRIES) {
+					tx_dropped++;
+					tx_tail = uint8_t(tx_tail + 1);
+				} else {
+					backoffs++;
+					uint32_t exp = out.tries < RADIO_BACKOFF_MAX_EXP ? out.tries : RADIO_BACKOFF_MAX_EXP;
+					out.due_ms = system_clock_ms + random.get(0, RADIO_BACKOFF_SLOT_MS << exp);
+				}
+		    	Listen();
 			}
 			
+			// Pendants heard directly within RADIO_NEIGHBOR_MS
+			uint32_t NeighborCount() const {
+				uint32_t count = 0;
+				for (uint32_t c=0; c<RADIO_NEIGHBORS; c++) {
+					if (neighbors[c].sender && (system_clock_ms - neighbors[c].heard_ms) <= RADIO_NEIGHBOR_MS) {
+						count++;
+					}
+				}
+				return count;
+			}
+
 			void SendMessage() {
-				char buf[24];
-				memcpy(buf,"DUCK!!",6);
-				buf[6] = 0;
+				// The sent count lives in the EEPROM, so the sequence keeps
+				// counting up across resets and stays clear of the dedupe
+				// caches of the others
+				uint16_t seq = uint16_t(settings.sent_message_count);
+				uint8_t buf[24];
+				buf[0] = RADIO_V2_MAGIC;
+				buf[1] = RADIO_V2_VERSION;
+				buf[2] = (RADIO_TYPE_MESSAGE << 4) | RADIO_TTL;
+				buf[3] = sender_id & 0xFF;
+				buf[4] = sender_id >> 8;
+				buf[5] = seq & 0xFF;
+				buf[6] = seq >> 8;
 				buf[7] = settings.radio_color;
 				memcpy(buf+8,settings.radio_messages[settings.radio_message],8);
 				memcpy(buf+16,settings.radio_name,8);
-				memcpy(txBuffer,buf,24);
-				SendBuffer();
+				tx_power = ChoosePower();
+				uint8_t frame[24];
+				uint8_t size = Compact(buf, frame);
+				if (!size) {
+					memcpy(frame,buf,24);
+					size = LORA_BUFFER_SIZE;
+				}
+				Queue(frame, size, 0, tx_power);
 				settings.UpdateSentCount();
-				settings.RecordMessage(ft25h16s, txBuffer);
+				settings.RecordMessage(ft25h16s, buf);
 			}
 			
 	private:
@@ -4381,11 +6243,202 @@ class SX1280 {
 				NVIC_DisableIRQ(PIN_INT0_IRQn);
 			}
 
+			// 8 characters from ' ' to '_' in 6 bytes, which covers the
+			// presets and the name editor. False if one is outside.
+			static bool Pack6(const uint8_t *str, uint8_t *out) {
+				uint32_t acc = 0;
+				uint32_t bits = 0;
+				for (uint32_t c=0; c<8; c++) {
+					uint32_t v = uint32_t(str[c] - 0x20);
+					if (v >= 64) {
+#ifdef LORA_IMPLICIT_HEADER
+						// No room for the 24 byte fallback
+						v = '?' - 0x20;
+#else  // #ifdef LORA_IMPLICIT_HEADER
+						return false;
+#endif  // #ifdef LORA_IMPLICIT_HEADER
+					}
+					acc = (acc << 6) | v;
+					bits += 6;
+					if (bits >= 8) {
+						bits -= 8;
+						*out++ = uint8_t(acc >> bits);
+					}
+				}
+				return true;
+			}
+
+			static void Unpack6(const uint8_t *in, uint8_t *str) {
+				uint32_t acc = 0;
+				uint32_t bits = 0;
+				for (uint32_t c=0; c<8; c++) {
+					if (bits < 6) {
+						acc = (acc << 8) | *in++;
+						bits += 8;
+					}
+					bits -= 6;
+					str[c] = uint8_t(0x20 + ((acc >> bits) & 0x3F));
+				}
+			}
+
+			// v2 frame to compact, returns the size or 0 if it does not fit
+			uint8_t Compact(const uint8_t *frame, uint8_t *out) {
+				uint32_t ttl = frame[2] & 0x0F;
+				if ((frame[2] >> 4) != RADIO_TYPE_MESSAGE || ttl > 3 || frame[7] > 15) {
+					return 0;
+				}
+				out[0] = uint8_t(RADIO_COMPACT | (ttl << 4) | frame[7]);
+				out[1] = frame[3];
+				out[2] = frame[4];
+				out[3] = frame[5];
+				out[4] = uint8_t(tx_power);
+				if (!Pack6(frame+16, out+5)) {
+					return 0;
+				}
+				for (uint32_t c=0; c<8; c++) {
+					if (memcmp(frame+8, radio_presets[c], 8) == 0) {
+						out[0] |= RADIO_COMPACT_PRESET;
+						out[11] = uint8_t(c);
+#ifdef LORA_IMPLICIT_HEADER
+						memset(out+12, 0, RADIO_COMPACT_SIZE-12);
+						return RADIO_COMPACT_SIZE;
+#else  // #ifdef LORA_IMPLICIT_HEADER
+						return 12;
+#endif  // #ifdef LORA_IMPLICIT_HEADER
+					}
+				}
+				if (!Pack6(frame+8, out+11)) {
+					return 0;
+				}
+				return RADIO_COMPACT_SIZE;
+			}
+
+			// Compact frame to v2, false if it is short or malformed
+			bool Expand(const uint8_t *in, uint8_t size, uint8_t *frame) {
+				bool preset = (in[0] & RADIO_COMPACT_PRESET) != 0;
+				if (size < (preset ? 12 : RADIO_COMPACT_SIZE) || (preset && in[11] >= 8)) {
+					return false;
+				}
+				frame[0] = RADIO_V2_MAGIC;
+				frame[1] = RADIO_V2_VERSION;
+				frame[2] = uint8_t((RADIO_TYPE_MESSAGE << 4) | ((in[0] >> 4) & 0x03));
+				frame[3] = in[1];
+				frame[4] = in[2];
+				frame[5] = in[3];
+				frame[6] = 0;	// not sent, Seen() only compares the low byte
+				frame[7] = in[0] & 0x0F;
+				if (preset) {
+					memcpy(frame+8, radio_presets[in[11]], 8);
+				} else {
+					Unpack6(in+11, frame+8);
+				}
+				Unpack6(in+5, frame+16);
+				return true;
+			}
+
+			void UpdateNeighbor(uint16_t sender, int8_t power, const Packet &packet) {
+				Neighbor *slot = &neighbors[0];
+				for (uint32_t c=0; c<RADIO_NEIGHBORS; c++) {
+					if (neighbors[c].sender == sender) {
+						slot = &neighbors[c];
+						break;
+					}
+					if (int32_t(neighbors[c].heard_ms - slot->heard_ms) < 0) {
+						slot = &neighbors[c];
+					}
+				}
+				if (slot->sender != sender) {
+					slot->sender = sender;
+					slot->rssi = packet.rssi;
+					slot->snr = packet.snr;
+				}
+				// Smooth out fading, 1/4 of the new reading
+				slot->rssi = int8_t((3 * slot->rssi + packet.rssi) / 4);
+				slot->snr = int8_t((3 * slot->snr + packet.snr) / 4);
+				slot->power = power;
+				slot->heard_ms = system_clock_ms;
+			}
+
+			int8_t ChoosePower() {
+				if ((settings.sent_message_count % RADIO_PROBE_EVERY) == 0) {
+					return int8_t(TX_OUTPUT_POWER);
+				}
+				int32_t power = RADIO_POWER_MIN;
+				bool known = false;
+				for (uint32_t c=0; c<RADIO_NEIGHBORS; c++) {
+					const Neighbor &n = neighbors[c];
+					if (!n.sender || (system_clock_ms - n.heard_ms) > RADIO_NEIGHBOR_MS) {
+						continue;
+					}
+					// Path loss n.power - n.rssi, the same both ways
+					int32_t need = n.power - n.rssi + RADIO_SENSITIVITY_DBM + RADIO_MARGIN_DB;
+					// Below the noise floor the RSSI is mostly noise and reads high
+					if (n.snr < 0) {
+						need = int32_t(TX_OUTPUT_POWER);
+					}
+					if (need > power) {
+						power = need;
+					}
+					known = true;
+				}
+				if (!known || power > int32_t(TX_OUTPUT_POWER)) {
+					return int8_t(TX_OUTPUT_POWER);
+				}
+				return int8_t(power);
+			}
+
+			// Direct mapped, a collision only forgets the older entry. Compact
+			// frames only carry the low byte of the sequence, so that is all
+			// both forms of a message are compared by. Entries expire long
+			// before the low byte comes around again.
+			bool Seen(uint16_t sender, uint8_t seq) {
+				SeenEntry &entry = seen[(sender ^ (seq * 7)) & (RADIO_SEEN_SIZE - 1)];
+				if (entry.sender == sender && entry.seq == seq &&
+					(system_clock_ms - entry.heard_ms) < RADIO_SEEN_MS) {
+					return true;
+				}
+				entry.sender = sender;
+				entry.seq = seq;
+				entry.heard_ms = system_clock_ms;
+				return false;
+			}
+
 			void enableIRQ() {
 				NVIC_EnableIRQ(PIN_INT0_IRQn);
 			}
 
 			uint8_t spiwrite(uint8_t val) {
+				spitransfer(&val, &val, 1);
+				return val;
+			}
+
+			// Mode 0 bit-bang through the byte pin registers, each edge is a
+			// single store and each MISO sample a single load. The SSPs are
+			// no option, both drive the LEDs and 0_7 has no SCK function.
+			// Sends zeros without tx and drops the input without rx, CSEL is
+			// left to the caller so a whole command goes out in one burst.
+			void spitransfer(const uint8_t *tx, uint8_t *rx, uint32_t size) {
+				volatile uint8_t &sclk = LPC_GPIO->B[SPI_SCLK>>8][SPI_SCLK&0xFF];
+				volatile uint8_t &mosi = LPC_GPIO->B[SPI_MOSI>>8][SPI_MOSI&0xFF];
+				volatile uint8_t &miso = LPC_GPIO->B[SPI_MISO>>8][SPI_MISO&0xFF];
+				for (uint32_t i = 0; i < size; i++) {
+					uint32_t val = tx ? tx[i] : 0;
+					uint32_t read_value = 0;
+					for (uint32_t c=0; c<8; c++) {
+						sclk = 0;
+						mosi = (val >> 7) & 1;	// only bit 0 drives the pin
+						val <<= 1;
+						read_value = (read_value << 1) | miso;
+						sclk = 1;
+					}
+					if (rx) {
+						rx[i] = read_value;
+					}
+				}
+			}
+
+#ifdef ENABLE_PROFILER
+			uint8_t spiwrite_reference(uint8_t val) {
 				Chip_GPIO_SetPinOutLow(LPC_GPIO, (SPI_SCLK>>8), (SPI_SCLK&0xFF));
 				uint8_t read_value = 0;
 				for (uint32_t c=0; c<8; c++) {
@@ -4401,6 +6454,22 @@ class SX1280 {
 				}
 				return read_value;
 			}
+
+			void ReadBufferReference( uint8_t offset, uint8_t *buffer, uint8_t size ) {
+				while ( Chip_GPIO_GetPinState(LPC_GPIO, uint8_t(BUSY_PIN>>8), uint8_t(BUSY_PIN&0xFF)) == 1) { };
+
+				Chip_GPIO_SetPinOutLow(LPC_GPIO, (SPI_CSEL>>8), (SPI_CSEL&0xFF));
+				spiwrite_reference( RADIO_READ_BUFFER );
+				spiwrite_reference( offset );
+				spiwrite_reference( 0 );
+				for( uint16_t i = 0; i < size; i++ ) {
+					buffer[i] = spiwrite_reference( 0 );
+				}
+				Chip_GPIO_SetPinOutHigh(LPC_GPIO, (SPI_CSEL>>8), (SPI_CSEL&0xFF));
+
+				while ( Chip_GPIO_GetPinState(LPC_GPIO, uint8_t(BUSY_PIN>>8), uint8_t(BUSY_PIN&0xFF)) == 1) { };
+			}
+#endif  // #ifdef ENABLE_PROFILER
 						
 			int32_t complement2( const uint32_t num, const uint8_t bitCnt ) {
 				int32_t retVal = int32_t(num);
@@ -4413,116 +6482,104 @@ class SX1280 {
     RadioOperatingModes 	OperatingMode = MODE_SLEEP;
 	RadioPacketTypes 		PacketType = PACKET_TYPE_NONE;
     RadioLoRaBandwidths 	LoRaBandwidth = LORA_BW_0200;
-    bool 					IrqState = false;
+    RadioLoRaSpreadingFactors LoRaSpreadingFactor = LORA_SF11;
+    RadioLoRaCodingRates 	LoRaCodingRate = LORA_CR_4_5;
+    int8_t 					LoRaTxPower = 0;
+    PacketParams 			LoRaPacketParams;
+    volatile bool 			IrqState = false;
+    uint32_t 				irq_time_us = 0;
+    uint32_t 				irq_poll_ms = 0;
+    bool 					device_present = false;
+
+	Packet 					rx_queue[RADIO_RX_QUEUE_SIZE];
+	volatile uint8_t 		rx_head = 0;
+	volatile uint8_t 		rx_tail = 0;
+
+	struct SeenEntry {
+		uint16_t sender;
+		uint8_t seq;
+		uint32_t heard_ms;
+	};
+	SeenEntry 				seen[RADIO_SEEN_SIZE] = { };
+
+	struct Neighbor {
+		uint16_t sender;
+		int8_t power;
+		int8_t rssi;
+		int8_t snr;
+		uint32_t heard_ms;
+	};
+	Neighbor 				neighbors[RADIO_NEIGHBORS] = { };
+
+	struct Outgoing {
+		uint8_t data[24];
+		uint8_t size;
+		int8_t power;
+		uint8_t tries;		// busy CADs so far
+		uint32_t due_ms;
+	};
+	Outgoing 				tx_queue[RADIO_TX_QUEUE_SIZE];
+	volatile uint8_t 		tx_head = 0;
+	volatile uint8_t 		tx_tail = 0;
+	uint32_t 				cad_start_ms = 0;
+	Random 					random;
     bool 					PollingMode = true;
 
 };
 
-class UI {
-	
-	EEPROM &settings;
-	SDD1306 &sdd1306;
-	SX1280 &sx1280;
-	Random &random;
-	FT25H16S &ft25h16s;
-	BQ24295 &bq24295;
-	
-	uint32_t mode;
-	uint32_t mode_start_time;
-
-	uint32_t top_fall_time;
-	bool top_button_down;
-	bool top_short_press;
-	
-	uint32_t bottom_fall_time;
-	bool bottom_button_down;
-	bool bottom_short_press;
-	
-	int32_t previous_mode;
-	int32_t interlude;
-
+// Debounces the two buttons and turns them into gestures. The pin
+// interrupts only wake the sampler, which then runs from a TIMER32_0
+// match until both buttons are released and settled again, so nothing
+// runs while no button is touched.
+class Buttons {
 
-	int32_t menu_scroll;
-	int32_t max_menu;
-	int32_t max_menu_scroll;
-	int32_t menu_selection;
-	
-	bool ring_or_duck;
-	int32_t rgb_selection;
-	
-	int32_t radio_settings_selection;
-	
-	int32_t radio_selection;
-
-	int32_t radio_name_selection;
-
-	int32_t radio_message_selection;
-	int32_t radio_message_current;
+public:
 
-	int32_t stats_select_current;
-	int32_t stats_menu_selection;
+	#define BUTTON_SAMPLE_MS 2		// sampling period while a button is active
+	#define BUTTON_DEBOUNCE 3		// equal samples before a change counts
+	#define BUTTON_LONG_MS 750
+	#define BUTTON_HOLD_MS 5000
+	#define BUTTON_DOUBLE_MS 300	// from a short press to the start of the next
+	#define BUTTON_QUEUE_SIZE 8
+
+	enum Button {
+		BUTTON_TOP,
+		BUTTON_BOTTOM,
+		BUTTON_COUNT
+	};
 
-	int32_t history_select_current;
-	int32_t history_menu_selection;
-	
-public:
+	enum Gesture {
+		PRESS,
+		RELEASE,
+		SHORT,		// released before BUTTON_LONG_MS
+		LONG,		// held for BUTTON_LONG_MS, no SHORT follows
+		HOLD,		// held for BUTTON_HOLD_MS
+		DOUBLE,		// second SHORT within BUTTON_DOUBLE_MS, after its SHORT
+		CHORD		// both buttons down, neither gives SHORT, LONG or HOLD
+	};
 
-	#define LONG_PRESS_TIME 750
-	
-	UI(EEPROM &_settings,
-	   SDD1306 &_sdd1306,
-	   SX1280 &_sx1280,
-	   Random &_random,
-	   FT25H16S &_ft25h16s,
-	   BQ24295 &_bq24295):
-		settings(_settings),
-		sdd1306(_sdd1306),
-		sx1280(_sx1280),
-		random(_random),
-		ft25h16s(_ft25h16s),
-		bq24295(_bq24295) {
-	}
+	struct Event {
+		uint8_t gesture;
+		uint8_t button;
+		uint32_t time_us;	// when the physical action completed the gesture
+	};
 
 	const uint32_t PRIMARY_BUTTON = 0x0119;
 	const uint32_t SECONDARY_BUTTON = 0x0001;
 
 	void Init() {
-		mode = 0;
-		
-		top_fall_time = 0;
-		top_button_down = false;
-		top_short_press = false;
-		bottom_fall_time = 0;
-		bottom_button_down = false;
-		bottom_short_press = false;
-		
-		menu_scroll = 0;
-		max_menu = 7;
-		max_menu_scroll = 4;
-		menu_selection = 0;
-		
-		ring_or_duck = false;
-		
-		rgb_selection = 0;
-		
-		radio_settings_selection = 0;
-		
-		radio_selection = 0;
-		
-		radio_name_selection = 0;
-		
-		radio_message_selection = 0;
-		radio_message_current = 0;
-
-		mode_start_time = 0;
-		previous_mode = 0;
-		interlude = 0;
-		
-		stats_select_current = 0;
-		stats_menu_selection = 0;
-
-		history_select_current = 0;
-		history_menu_selection = 0;
+		memset(state, 0, sizeof(state));
+		for (uint32_t c=0; c<BUTTON_COUNT; c++) {
+			forced[c] = NOT_FORCED;
+		}
+		chord = false;
+		sampling = false;
+		head = 0;
+		tail = 0;
+		dropped = 0;
+		events = 0;
+		latency_us = 0;
+		latency_us_max = 0;
 
 		Chip_IOCON_PinMuxSet(LPC_IOCON, uint8_t(PRIMARY_BUTTON>>8), uint8_t(PRIMARY_BUTTON&0xFF), IOCON_FUNC0 | IOCON_MODE_PULLUP);
 		Chip_GPIO_SetPinDIRInput(LPC_GPIO, uint8_t(PRIMARY_BUTTON>>8), uint8_t(PRIMARY_BUTTON&0xFF));
@@ -4547,359 +6604,634 @@ public:
 		NVIC_ClearPendingIRQ(PIN_INT2_IRQn);  
 		Chip_PININT_ClearIntStatus(LPC_PININT, PININTCH2);
 		NVIC_EnableIRQ(PIN_INT2_IRQn);  
-	}
 
-	void HandleINT1IRQ() {
-		uint32_t timer_ms = Chip_TIMER_ReadCount(LPC_TIMER32_0);
-		if ( (Chip_PININT_GetFallStates(LPC_PININT) & PININTCH1) ) {
-			Chip_PININT_ClearFallStates(LPC_PININT, PININTCH1);
-			top_fall_time = timer_ms;
-			top_button_down = true;
-			Chip_PININT_ClearIntStatus(LPC_PININT, PININTCH1);
-		}
-
-		if ( (Chip_PININT_GetRiseStates(LPC_PININT) & PININTCH1) ) {
-			Chip_PININT_ClearRiseStates(LPC_PININT, PININTCH1);
-			if ( top_button_down && (timer_ms - top_fall_time) > 10 && ((timer_ms - top_fall_time) < LONG_PRESS_TIME)) {
-				top_short_press = true;
+		// The sampler shares the ms timer, MR0 is only armed while active
+		Chip_TIMER_MatchDisableInt(LPC_TIMER32_0, 0);
+		Chip_TIMER_ClearMatch(LPC_TIMER32_0, 0);
+		NVIC_ClearPendingIRQ(TIMER_32_0_IRQn);
+		NVIC_EnableIRQ(TIMER_32_0_IRQn);
+	}
+
+	// Any edge on a button pin
+	void HandleEdgeIRQ(uint32_t channel, Button button) {
+		Chip_PININT_ClearFallStates(LPC_PININT, channel);
+		Chip_PININT_ClearRiseStates(LPC_PININT, channel);
+		Chip_PININT_ClearIntStatus(LPC_PININT, channel);
+		Edge(button);
+	}
+
+	// Overrides the level the sampler reads from a pin, as if the button
+	// went down or up, used by '@PIN'. Debounce and gesture detection run
+	// as they do for the pin itself. Release() goes back to the pins.
+	void Force(Button button, bool down) {
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		forced[button] = down ? FORCED_DOWN : FORCED_UP;
+		Edge(button);
+		__set_PRIMASK(primask);
+	}
+
+	void Release() {
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		for (uint32_t c=0; c<BUTTON_COUNT; c++) {
+			if (forced[c] != NOT_FORCED) {
+				forced[c] = NOT_FORCED;
+				Edge(Button(c));
+			}
+		}
+		__set_PRIMASK(primask);
+	}
+
+	void HandleTimerIRQ() {
+		Chip_TIMER_ClearMatch(LPC_TIMER32_0, 0);
+		uint32_t now_ms = Chip_TIMER_ReadCount(LPC_TIMER32_0);
+
+		bool active = false;
+		for (uint32_t c=0; c<BUTTON_COUNT; c++) {
+			State &b = state[c];
+			bool down = Down(c);
+			if (down != bool(b.down)) {
+				if (++b.count >= BUTTON_DEBOUNCE) {
+					b.count = 0;
+					b.bouncing = false;
+					b.down = down;
+					if (down) {
+						Pressed(Button(c), now_ms);
+					} else {
+						Released(Button(c), now_ms);
+					}
+				}
+			} else {
+				// A glitch shorter than the debounce time
+				b.count = 0;
+				b.bouncing = false;
+			}
+			if (b.down && !chord) {
+				uint32_t held = now_ms - b.press_ms;
+				if (!b.long_sent && held >= BUTTON_LONG_MS) {
+					b.long_sent = true;
+					Push(LONG, Button(c), b.press_us + BUTTON_LONG_MS * 1000);
+				}
+				if (!b.hold_sent && held >= BUTTON_HOLD_MS) {
+					b.hold_sent = true;
+					Push(HOLD, Button(c), b.press_us + BUTTON_HOLD_MS * 1000);
+				}
 			}
-			top_button_down = false;
-			Chip_PININT_ClearIntStatus(LPC_PININT, PININTCH1);
+			active |= b.down || b.count || b.bouncing;
+		}
+
+		if (active) {
+			Chip_TIMER_SetMatch(LPC_TIMER32_0, 0, now_ms + BUTTON_SAMPLE_MS);
+		} else {
+			Chip_TIMER_MatchDisableInt(LPC_TIMER32_0, 0);
+			sampling = false;
 		}
 	}
-	
-	void TopLongPress() {
-		uint32_t timer_ms = Chip_TIMER_ReadCount(LPC_TIMER32_0);
-		if ( top_button_down && (timer_ms - top_fall_time) > LONG_PRESS_TIME) {
-			if (Mode() != 0) {
-				SetMode(system_clock_ms, 0);
-			} else {
-				SetMode(system_clock_ms, 2);
-			}
-			top_button_down = false;
+
+	// Consumer side of the queue, only ever called from one context
+	bool Pop(Event &event) {
+		if (tail == head) {
+			return false;
 		}
+		event = queue[tail % BUTTON_QUEUE_SIZE];
+		tail = uint8_t(tail + 1);
+		return true;
 	}
 
-	void TopShortPress() {
-		if (top_short_press) {
-			top_short_press = false;
-			switch (mode) {
-				case 	0: {
-					settings.NextEffect();
-				} break;
-				case	1: {
-					// NOP
-				} break;
-				case	2: {
-					SettingsHandler(true, false);
-				} break;
-				case	3: {
-					RGBGHandler(true, false);
-				} break;
-				case	4: {
-					RadioSettingsHandler(true, false);
-				} break;
-				case	5: {
-					RadioHandler(true, false);
-				} break;
-				case	6: {
-					// NOP
-				} break;
-				case	7: {
-					NameSettingsHandler(true, false);
-				} break;
-				case	8: {
-					MessageSettingsHandler(true, false);
-				} break;
-				case	9: {
-					StatsHandler(true, false);
-				} break;
-				case	10: {
-					HistoryHandler(true, false);
-				} break;
-			}
+	// Feeds a gesture as if it came from the buttons, used by '@KEY'. Skips
+	// the pins and the debounce, Force() goes through both.
+	void Inject(Gesture gesture, Button button) {
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		Push(gesture, button, micros());
+		__set_PRIMASK(primask);
+	}
+
+	// Called once the UI has acted on an event
+	void Acted(const Event &event) {
+		Trace::Complete(Trace::INPUT, event.time_us);
+		latency_us = micros() - event.time_us;
+		if (latency_us > latency_us_max) {
+			latency_us_max = latency_us;
 		}
+		events++;
 	}
-	
-	void HandleINT2IRQ() {
-		uint32_t timer_ms = Chip_TIMER_ReadCount(LPC_TIMER32_0);
-		if ( (Chip_PININT_GetFallStates(LPC_PININT) & PININTCH2) ) {
-			Chip_PININT_ClearFallStates(LPC_PININT, PININTCH2);
-			bottom_fall_time = timer_ms;
-			bottom_button_down = true;
-			Chip_PININT_ClearIntStatus(LPC_PININT, PININTCH2);
+
+	uint32_t Events() const { return events; }
+	uint32_t Dropped() const { return dropped; }
+	uint32_t LatencyMicros() const { return latency_us; }
+	uint32_t LatencyMicrosMax() const { return latency_us_max; }
+
+private:
+
+	struct State {
+		uint32_t edge_us;		// first edge of the current change
+		uint32_t press_us;
+		uint32_t press_ms;
+		uint32_t short_ms;		// end of the last SHORT
+		uint8_t count;
+		bool down;
+		bool bouncing;
+		bool long_sent;
+		bool hold_sent;
+		bool double_armed;
+		bool short_valid;
+	};
+
+	enum Forced {
+		NOT_FORCED,
+		FORCED_UP,
+		FORCED_DOWN
+	};
+
+	uint32_t Pin(uint32_t button) const {
+		return button == BUTTON_TOP ? PRIMARY_BUTTON : SECONDARY_BUTTON;
+	}
+
+	bool Down(uint32_t button) const {
+		if (forced[button] != NOT_FORCED) {
+			return forced[button] == FORCED_DOWN;
 		}
+		return !Chip_GPIO_GetPinState(LPC_GPIO, uint8_t(Pin(button)>>8), uint8_t(Pin(button)&0xFF));
+	}
 
-		if ( (Chip_PININT_GetRiseStates(LPC_PININT) & PININTCH2) ) {
-			Chip_PININT_ClearRiseStates(LPC_PININT, PININTCH2);
-			if ( bottom_button_down && (timer_ms - bottom_fall_time) > 10 && ((timer_ms - bottom_fall_time) < LONG_PRESS_TIME)) {
-				bottom_short_press = true;
+	// Starts sampling after a change of the level, from the pin interrupts
+	// or with interrupts off
+	void Edge(Button button) {
+		State &b = state[button];
+		if (!b.bouncing) {
+			b.bouncing = true;
+			b.edge_us = micros();
+		}
+		if (!sampling) {
+			sampling = true;
+			Chip_TIMER_ClearMatch(LPC_TIMER32_0, 0);
+			Chip_TIMER_SetMatch(LPC_TIMER32_0, 0, Chip_TIMER_ReadCount(LPC_TIMER32_0) + BUTTON_SAMPLE_MS);
+			Chip_TIMER_MatchEnableInt(LPC_TIMER32_0, 0);
+		}
+	}
+
+	void Pressed(Button button, uint32_t now_ms) {
+		State &b = state[button];
+		b.press_ms = now_ms;
+		b.press_us = b.edge_us;
+		b.long_sent = false;
+		b.hold_sent = false;
+		b.double_armed = b.short_valid && (now_ms - b.short_ms) <= BUTTON_DOUBLE_MS;
+		Push(PRESS, button, b.edge_us);
+		if (!chord && state[button ^ 1].down) {
+			chord = true;
+			Push(CHORD, button, b.edge_us);
+		}
+	}
+
+	void Released(Button button, uint32_t now_ms) {
+		State &b = state[button];
+		Push(RELEASE, button, b.edge_us);
+		if (!chord && !b.long_sent) {
+			Push(SHORT, button, b.edge_us);
+			if (b.double_armed) {
+				Push(DOUBLE, button, b.edge_us);
+				b.short_valid = false;
+			} else {
+				b.short_ms = now_ms;
+				b.short_valid = true;
 			}
-			bottom_button_down = false;
-			Chip_PININT_ClearIntStatus(LPC_PININT, PININTCH2);
+		} else {
+			b.short_valid = false;
+		}
+		if (!state[0].down && !state[1].down) {
+			chord = false;
 		}
 	}
+
+	void Push(Gesture gesture, Button button, uint32_t time_us) {
+		if (uint8_t(head - tail) >= BUTTON_QUEUE_SIZE) {
+			dropped++;
+			return;
+		}
+		Event &event = queue[head % BUTTON_QUEUE_SIZE];
+		event.gesture = gesture;
+		event.button = button;
+		event.time_us = time_us;
+		head = uint8_t(head + 1);
+	}
+
+	State state[BUTTON_COUNT];
+	volatile uint8_t forced[BUTTON_COUNT];
+	bool chord;
+	bool sampling;
+
+	Event queue[BUTTON_QUEUE_SIZE];
+	volatile uint8_t head;
+	volatile uint8_t tail;
+	uint32_t dropped;
+
+	uint32_t events;
+	uint32_t latency_us;
+	uint32_t latency_us_max;
+};
+
+// Vertical shift curves of the interludes. Each keyframe samples its curve
+// at step_ms from its own start and holds the last value.
+enum EaseCurve {
+	EASE_NONE,
+	EASE_BOUNCE,
+	EASE_EXIT,
+	EASE_COUNT
+};
+
+static constexpr int8_t ease_bounce[64] = {
+	0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x1d, 0x1d, 
+	0x1c, 0x1b, 0x1a, 0x18, 0x17, 0x16, 0x14, 0x12, 
+	0x10, 0x0e, 0x0c, 0x0a, 0x08, 0x05, 0x03, 0x01, 
+	0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x07, 
+	0x06, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x01, 
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 
+};
+
+static constexpr int8_t ease_exit[33] = {
+	 0x00,  0x00,  0x00,  0x00,  0x00,  0x00, -0x01, -0x01, 
+	-0x02, -0x02, -0x03, -0x03, -0x04, -0x05, -0x06, -0x07, 
+	-0x08, -0x09, -0x0a, -0x0b, -0x0c, -0x0e, -0x0f, -0x11, 
+	-0x12, -0x14, -0x15, -0x17, -0x19, -0x1b, -0x1d, -0x1f, 
+	-0x1f,
+};
+
+static constexpr struct {
+	const int8_t *table;
+	uint8_t length;
+	uint8_t step_ms;
+} ease_curves[EASE_COUNT] = {
+	{ 0, 0, 1 },
+	{ ease_bounce, 64, 10 },
+	{ ease_exit, 33, 5 },
+};
+
+// One step of an interlude, a timeline ends with a zero duration
+struct Keyframe {
+	#define KEY_GLYPHS		0x01	// place the timeline's glyph block
+	#define KEY_BLINK		0x02	// blink all but the bottom row of the block
+	#define KEY_TRANSITION	0x04	// run the exit transition along the curve
+
+	uint16_t duration_ms;
+	uint8_t curve;
+	uint8_t flags;
+};
+
+struct Timeline {
+	uint16_t glyph_block;	// first of 4 rows of 8 consecutive glyphs
+	Keyframe keys[5];
+};
+
+static constexpr Timeline timeline_boot = { 0x80, {
+	{ 50, EASE_BOUNCE, KEY_GLYPHS },
+	{ 640, EASE_BOUNCE, 0 },
+	{ 500, EASE_NONE, 0 },
+	{ 160, EASE_EXIT, KEY_TRANSITION },
+	{ 0, EASE_NONE, 0 },
+} };
+
+static constexpr Timeline timeline_dog = { 0x128, {
+	{ 50, EASE_NONE, KEY_GLYPHS },
+	{ 640 + 50, EASE_BOUNCE, 0 },
+	{ 2000, EASE_NONE, 0 },
+	{ 160, EASE_EXIT, KEY_TRANSITION },
+	{ 0, EASE_NONE, 0 },
+} };
+
+static constexpr Timeline timeline_now = { 0xB8, {
+	{ 50, EASE_NONE, KEY_GLYPHS },
+	{ 640 + 50, EASE_BOUNCE, 0 },
+	{ 1000, EASE_NONE, KEY_GLYPHS | KEY_BLINK },
+	{ 160, EASE_EXIT, KEY_TRANSITION },
+	{ 0, EASE_NONE, 0 },
+} };
+
+// The message screen places its own glyphs
+static constexpr Timeline timeline_message = { 0, {
+	{ 50, EASE_NONE, 0 },
+	{ 640 + 50, EASE_BOUNCE, 0 },
+	{ 5000, EASE_NONE, 0 },
+	{ 160, EASE_EXIT, KEY_TRANSITION },
+	{ 0, EASE_NONE, 0 },
+} };
+
+class UI {
+	
+	EEPROM &settings;
+	SDD1306 &sdd1306;
+	SX1280 &sx1280;
+	Random &random;
+	FT25H16S &ft25h16s;
+	BQ24295 &bq24295;
+	Buttons &buttons;
 	
+	uint32_t mode;
+	uint32_t mode_start_time;
+
+	int32_t previous_mode;
+	int32_t interlude;
+	SDD1306::Transition exit_transition;
+	uint32_t timeline_key;
+	uint32_t timeline_key_start;
+
+
+	// State of the menu on screen, reset whenever the mode changes
+	struct Menu {
+		int8_t selection;	// highlighted entry, 0 leaves the screen
+		int8_t scroll;		// entry shown in row 1
+		int32_t item;		// what the screen pages through or toggles
+	} menu;
+
+	// One entry per mode. The icons and the title are placed once when
+	// the mode is entered, render only places what changes.
+	#define UI_MODE_COUNT 12
+
+	struct Screen {
+		void (UI::*render)();
+		void (UI::*input)(bool top_pressed, bool bottom_pressed);
+		uint16_t icons[4];		// glyph in column 0 of each row, 0 for none
+		uint16_t title;			// first of 7 consecutive glyphs in row 0, 0 for none
+		uint8_t invalid;		// UI_INVALID_* bits which need a redraw
+		uint16_t refresh_ms;	// redraw period, 0 to redraw on invalidation only
+	};
+
+	static const Screen screens[UI_MODE_COUNT];
+
+	uint32_t next_frame_ms;
+	uint32_t battery_sample_ms;
+	uint8_t bat_stat;
+	bool bad_connection;
+	uint32_t clock_glyph;
+	
+public:
+
+	#define UI_FRAME_MS 4		// animated screens
+	#define UI_REFRESH_MS 1000	// screens showing live counters
+	#define UI_BATTERY_MS 250	// charger status and battery ADC
+	
+	UI(EEPROM &_settings,
+	   SDD1306 &_sdd1306,
+	   SX1280 &_sx1280,
+	   Random &_random,
+	   FT25H16S &_ft25h16s,
+	   BQ24295 &_bq24295,
+	   Buttons &_buttons):
+		settings(_settings),
+		sdd1306(_sdd1306),
+		sx1280(_sx1280),
+		random(_random),
+		ft25h16s(_ft25h16s),
+		bq24295(_bq24295),
+		buttons(_buttons) {
+	}
+
+	void Init() {
+		mode = 0;
+		
+		menu.selection = 0;
+		menu.scroll = 0;
+		menu.item = 0;
+
+		mode_start_time = 0;
+		previous_mode = 0;
+		interlude = 0;
+		exit_transition = SDD1306::TRANSITION_FLIP;
+		timeline_key = 0;
+		timeline_key_start = 0;
+
+
+		next_frame_ms = 0;
+		battery_sample_ms = system_clock_ms - UI_BATTERY_MS;
+		bat_stat = 0;
+		bad_connection = false;
+		clock_glyph = 0;
+	}
+
 	void HardReset() {
 		sdd1306.PlaceAsciiStr(0,0,"        ");
 		sdd1306.PlaceAsciiStr(0,1,"  HARD  ");
 		sdd1306.PlaceAsciiStr(0,2," RESET! ");
 		sdd1306.PlaceAsciiStr(0,3,"[00/04] ");
-		sdd1306.Display();
+		sdd1306.SetVerticalShift(0);
+		sdd1306.SetTransition(0);
+		sdd1306.DisplayWait();
 
 		Chip_WWDT_SetTimeOut(LPC_WWDT, 60 * Chip_Clock_GetWDTOSCRate() / 4);
-		NVIC_DisableIRQ(I2C0_IRQn);
+		// I2C0 stays on, the progress screens go through its queue
 		NVIC_DisableIRQ(WDT_IRQn);
 		NVIC_DisableIRQ(PIN_INT0_IRQn);  
 		NVIC_DisableIRQ(PIN_INT1_IRQn);  
 		NVIC_DisableIRQ(PIN_INT2_IRQn);  
+		NVIC_DisableIRQ(TIMER_32_0_IRQn);
 
 		sdd1306.PlaceAsciiStr(0,3,"[01/04] ");
-		sdd1306.Display();
+		sdd1306.DisplayWait();
+
+#ifdef ENABLE_ASSET_STORE
+		uint32_t flash_end = settings.recv_flash_ptr;
+#endif  // #ifdef ENABLE_ASSET_STORE
 
 		settings.Reset(true);
 
 		sdd1306.PlaceAsciiStr(0,3,"[02/04] ");
-		sdd1306.Display();
+		sdd1306.DisplayWait();
 		
+#ifdef ENABLE_ASSET_STORE
+		// Keep the asset store, only erase what the message log used
+		for (uint32_t c = 0; c < flash_end && c < ASSET_BASE; c += 0x10000) {
+			ft25h16s.block_erase(c);
+		}
+#else  // #ifdef ENABLE_ASSET_STORE
 		ft25h16s.chip_erase();
+#endif  // #ifdef ENABLE_ASSET_STORE
 
 		sdd1306.PlaceAsciiStr(0,3,"[03/04] ");
-		sdd1306.Display();
+		sdd1306.DisplayWait();
 
 		EEPROM::loaded = false;
+		warm_state.Invalidate();
 		
 		delay(500);
 
 		sdd1306.PlaceAsciiStr(0,3,"[04/04] ");
-		sdd1306.Display();
+		sdd1306.DisplayWait();
 
 		delay(500);
 
 		NVIC_SystemReset();
 	}
 	
-	void BottomLongPress() {
-		uint32_t timer_ms = Chip_TIMER_ReadCount(LPC_TIMER32_0);
-		if (Mode() == 2 && menu_selection == 5) {
-			if ( bottom_button_down && (timer_ms - bottom_fall_time) > 5000) {
-				HardReset();
-				bottom_button_down = false;
-			}
-		} else if ( bottom_button_down && (timer_ms - bottom_fall_time) > LONG_PRESS_TIME) {
-			if (Mode() != 0) {
-				SetMode(system_clock_ms, 0);
-			} else {
-				SetMode(system_clock_ms, 5);
-			}
-			bottom_button_down = false;
+	// Drains the button queue, called from SysTick
+	void CheckInput() {
+		Buttons::Event event;
+		while (buttons.Pop(event)) {
+			HandleButton(event);
+			buttons.Acted(event);
 		}
 	}
-	
-	void BottomShortPress() {
-		if (bottom_short_press) {
-			bottom_short_press = false;
-			switch (mode) {
-				case 	0: {
-					settings.NextBrightness();
-				} break;
-				case	1: {
-					// NOP
-				} break;
-				case	2: {
-					SettingsHandler(false, true);
-				} break;
-				case	3: {
-					RGBGHandler(false, true);
-				} break;
-				case	4: {
-					RadioSettingsHandler(false, true);
-				} break;
-				case	5: {
-					RadioHandler(false, true);
-				} break;
-				case	6: {
-					// NOP
-				} break;
-				case	7: {
-					NameSettingsHandler(false, true);
-				} break;
-				case	8: {
-					MessageSettingsHandler(false, true);
-				} break;
-				case	9: {
-					StatsHandler(false, true);
-				} break;
-				case	10: {
-					HistoryHandler(false, true);
-				} break;
-			}
+
+	void HandleButton(const Buttons::Event &event) {
+		bool top = event.button == Buttons::BUTTON_TOP;
+		// Holding the bottom button on RESET is a hard reset
+		bool reset = !top && Mode() == 2 && menu.selection == 5;
+		switch (event.gesture) {
+			case	Buttons::SHORT: {
+						if (screens[mode].input) {
+							(this->*screens[mode].input)(top, !top);
+						}
+					} break;
+			case	Buttons::LONG: {
+						if (reset) {
+							break;
+						}
+						if (Mode() != 0) {
+							SetMode(system_clock_ms, 0);
+						} else {
+							SetMode(system_clock_ms, top ? 2 : 5);
+						}
+					} break;
+			case	Buttons::HOLD: {
+						if (reset) {
+							HardReset();
+						}
+					} break;
+			case	Buttons::CHORD: {
+						if (Mode() != 0) {
+							SetMode(system_clock_ms, 0);
+						}
+					} break;
 		}
 	}
-	
-	void CheckInput() {
-		TopLongPress();
-		TopShortPress();
-		BottomLongPress();
-		BottomShortPress();
-	}
 
 	void SetMode(uint32_t current_time, uint32_t _mode) {
 		mode_start_time = current_time;
 		previous_mode = mode;
 		mode = _mode;
+		menu.selection = 0;
+		menu.scroll = 0;
+		menu.item = 0;
 		sdd1306.ClearAttr();
+		PlaceStatic();
 		if (mode == 1) {
 			interlude = random.get(0,2);
 		}
+		if (mode == 1 || mode == 6) {
+			exit_transition = SDD1306::Transition(random.get(0,SDD1306::TRANSITION_COUNT));
+		} else {
+			exit_transition = SDD1306::TRANSITION_FLIP;
+		}
+		timeline_key = 0;
+		timeline_key_start = 0;
 		sdd1306.SetVerticalShift(0);
-		sdd1306.SetCenterFlip(0);
+		sdd1306.SetTransition(0);
 		Display();
+		ui_invalid &= ~UI_INVALID_MODE;
+		next_frame_ms = system_clock_ms + screens[mode].refresh_ms;
 	}
 	
 	uint32_t Mode() const { return mode; }
-	
-	void DisplayDog() {
-		if ((system_clock_ms - mode_start_time) < 50) {
-			for (int32_t c=0; c<8; c++) {
-				sdd1306.PlaceCustomChar(c,0,0x128+c);
-			}
-			for (int32_t c=0; c<8; c++) {
-				sdd1306.PlaceCustomChar(c,1,0x130+c);
-			}
-			for (int32_t c=0; c<8; c++) {
-				sdd1306.PlaceCustomChar(c,2,0x138+c);
-			}
-			for (int32_t c=0; c<8; c++) {
-				sdd1306.PlaceCustomChar(c,3,0x140+c);
-			}
-			sdd1306.SetVerticalShift(0);
-		}
-		else if ((system_clock_ms - mode_start_time) < 50 + 640 + 50) {
-			uint32_t ltime = (system_clock_ms - mode_start_time) - 50;
-			static uint8_t bounce[] = {
-				0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x1d, 0x1d, 
-				0x1c, 0x1b, 0x1a, 0x18, 0x17, 0x16, 0x14, 0x12, 
-				0x10, 0x0e, 0x0c, 0x0a, 0x08, 0x05, 0x03, 0x01, 
-				0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 
-				0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x07, 
-				0x06, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x01, 
-				0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-				0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 
-			};
-			uint32_t y = ltime/10;
-			if (y >= 64) y = 63;
-			sdd1306.Display();
-			sdd1306.SetVerticalShift(bounce[y]);
-		}
-		else if ((system_clock_ms - mode_start_time) < 2000 + 50 + 640 + 50) {
-		}
-		else if ((system_clock_ms - mode_start_time) < 160 + 2000 + 50 + 640 + 50) {
-			uint32_t ltime = (system_clock_ms - mode_start_time) - (2000 + 50 + 640 + 50);
-			static int8_t ease[] = {
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 
-				0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 
-				0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0e, 0x0f, 0x11, 
-				0x12, 0x14, 0x15, 0x17, 0x19, 0x1b, 0x1d, 0x1f, 
-				0x1f,
-			};
-			sdd1306.SetVerticalShift(-ease[ltime/5]);
-			sdd1306.SetCenterFlip(ltime/5);
-			sdd1306.Display();
-		} else {
-			mode = previous_mode;
-			sdd1306.ClearAttr();
-			DisplayStatus();
-			sdd1306.SetVerticalShift(0);
-			sdd1306.SetCenterFlip(0);
-			sdd1306.Display();
+
+	// Icons and title of the current screen on an otherwise empty screen
+	void PlaceStatic() {
+		const Screen &screen = screens[mode];
+		sdd1306.ClearText();
+		for (uint32_t y=0; y<4; y++) {
+			sdd1306.PlaceCustomChar(0,y,screen.icons[y]);
+		}
+		if (screen.title) {
+			PlaceGlyphs(1,0,screen.title,7);
 		}
 	}
 
-	void DisplayNow() {
-		if ((system_clock_ms - mode_start_time) < 50) {
-			for (int32_t c=0; c<8; c++) {
-				sdd1306.PlaceCustomChar(c,0,0xB8+c);
-			}
-			for (int32_t c=0; c<8; c++) {
-				sdd1306.PlaceCustomChar(c,1,0xC0+c);
-			}
-			for (int32_t c=0; c<8; c++) {
-				sdd1306.PlaceCustomChar(c,2,0xC8+c);
-			}
-			for (int32_t c=0; c<8; c++) {
-				sdd1306.PlaceCustomChar(c,3,0xD0+c);
-			}
-			sdd1306.SetVerticalShift(0);
-		}
-		else if ((system_clock_ms - mode_start_time) < 50 + 640 + 50) {
-			uint32_t ltime = (system_clock_ms - mode_start_time) - 50;
-			static uint8_t bounce[] = {
-				0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x1d, 0x1d, 
-				0x1c, 0x1b, 0x1a, 0x18, 0x17, 0x16, 0x14, 0x12, 
-				0x10, 0x0e, 0x0c, 0x0a, 0x08, 0x05, 0x03, 0x01, 
-				0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 
-				0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x07, 
-				0x06, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x01, 
-				0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-				0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 
-			};
-			uint32_t y = ltime/10;
-			if (y >= 64) y = 63;
-			sdd1306.Display();
-			sdd1306.SetVerticalShift(bounce[y]);
+	// count consecutive glyphs starting at x,y
+	void PlaceGlyphs(uint32_t x, uint32_t y, uint16_t first, uint32_t count) {
+		for (uint32_t c=0; c<count; c++) {
+			sdd1306.PlaceCustomChar(x+c,y,uint16_t(first+c));
 		}
-		else if ((system_clock_ms - mode_start_time) < 1000 + 50 + 640 + 50) {
-			uint32_t ltime = (system_clock_ms - mode_start_time) - (50 + 640 + 50);
-			if (((ltime / 100)&1) == 0) {
-				for (int32_t c=0; c<8; c++) {
-					sdd1306.PlaceCustomChar(c,0,0);
-				}
-				for (int32_t c=0; c<8; c++) {
-					sdd1306.PlaceCustomChar(c,1,0);
-				}
-				for (int32_t c=0; c<8; c++) {
-					sdd1306.PlaceCustomChar(c,2,0);
-				}
-				for (int32_t c=0; c<8; c++) {
-					sdd1306.PlaceCustomChar(c,3,0xD0+c);
-				}
-				sdd1306.Display();
-			} else if (((ltime / 100)&1) == 1) {
-				for (int32_t c=0; c<8; c++) {
-					sdd1306.PlaceCustomChar(c,0,0xB8+c);
-				}
-				for (int32_t c=0; c<8; c++) {
-					sdd1306.PlaceCustomChar(c,1,0xC0+c);
-				}
-				for (int32_t c=0; c<8; c++) {
-					sdd1306.PlaceCustomChar(c,2,0xC8+c);
-				}
-				for (int32_t c=0; c<8; c++) {
-					sdd1306.PlaceCustomChar(c,3,0xD0+c);
+	}
+
+	// Moves the highlight to the next of count entries, scrolls so that
+	// it stays within the 3 rows below the title.
+	void MenuNext(int32_t count) {
+		menu.selection++;
+		if (menu.selection >= count) {
+			menu.selection = 0;
+		}
+		menu.scroll = (menu.selection > 3) ? int8_t(menu.selection - 3) : 0;
+	}
+
+	// Inverts column 0 of row, -1 for none
+	void MenuHighlight(int32_t row) {
+		for (int32_t y=0; y<4; y++) {
+			sdd1306.SetAttr(0,y,(y == row) ? 1 : 0);
+		}
+	}
+
+	// The 3 entries from menu.scroll on in the rows below the title
+	void MenuList(const char *const *items) {
+		for (int32_t c=0; c<3; c++) {
+			sdd1306.PlaceAsciiStr(0,c+1,items[c+menu.scroll]);
+		}
+	}
+	
+	// Plays one frame of an interlude, false once the timeline is over.
+	// The current keyframe only ever moves forward, so this does not
+	// depend on the length of the timeline.
+	bool PlayTimeline(const Timeline &timeline) {
+		uint32_t time = system_clock_ms - mode_start_time;
+		while (timeline.keys[timeline_key].duration_ms &&
+			   (time - timeline_key_start) >= timeline.keys[timeline_key].duration_ms) {
+			timeline_key_start += timeline.keys[timeline_key].duration_ms;
+			timeline_key++;
+		}
+		const Keyframe &key = timeline.keys[timeline_key];
+		if (!key.duration_ms) {
+			return false;
+		}
+
+		uint32_t ltime = time - timeline_key_start;
+		if ((key.flags & KEY_GLYPHS)) {
+			bool blank = (key.flags & KEY_BLINK) && ((ltime / 100)&1) == 0;
+			for (uint32_t y=0; y<4; y++) {
+				for (uint32_t x=0; x<8; x++) {
+					sdd1306.PlaceCustomChar(x,y,(blank && y < 3) ? 0 : timeline.glyph_block+y*8+x);
 				}
-				sdd1306.Display();
 			}
 		}
-		else if ((system_clock_ms - mode_start_time) < 160 + 1000 + 50 + 640 + 50) {
-			uint32_t ltime = (system_clock_ms - mode_start_time) - (1000 + 50 + 640 + 50);
-			static int8_t ease[] = {
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 
-				0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 
-				0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0e, 0x0f, 0x11, 
-				0x12, 0x14, 0x15, 0x17, 0x19, 0x1b, 0x1d, 0x1f, 
-				0x1f,
-			};
-			sdd1306.SetVerticalShift(-ease[ltime/5]);
-			sdd1306.SetCenterFlip(ltime/5);
-			sdd1306.Display();
-		} else {
-			mode = previous_mode;
-			sdd1306.ClearAttr();
-			DisplayStatus();
-			sdd1306.SetVerticalShift(0);
-			sdd1306.SetCenterFlip(0);
-			sdd1306.Display();
+
+		int8_t shift = 0;
+		if (ease_curves[key.curve].length) {
+			uint32_t i = ltime / ease_curves[key.curve].step_ms;
+			if (i >= ease_curves[key.curve].length) i = ease_curves[key.curve].length - 1;
+			shift = ease_curves[key.curve].table[i];
+			if ((key.flags & KEY_TRANSITION)) {
+				sdd1306.SetTransition(int8_t(i), exit_transition);
+			}
+		}
+		sdd1306.SetVerticalShift(shift);
+		sdd1306.Display();
+		return true;
+	}
+
+	void FinishInterlude() {
+		mode = previous_mode;
+		ui_invalid |= UI_INVALID_MODE;
+		sdd1306.ClearAttr();
+		PlaceStatic();
+		sdd1306.SetVerticalShift(0);
+		sdd1306.SetTransition(0);
+		(this->*screens[mode].render)();
+	}
+
+	void DisplayInterlude() {
+		const Timeline &timeline = (mode == 11) ? timeline_boot : (interlude ? timeline_dog : timeline_now);
+		if (!PlayTimeline(timeline)) {
+			FinishInterlude();
 		}
 	}
 	
@@ -4908,40 +7240,14 @@ public:
 			return;
 		}
 		if (w == 7 && x <= 1) {
-			if (range == 0) {
-				const uint8_t val_to_chr[7*8] = {
-					0x6B, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x71,
-					0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x71,
-					0x6D, 0x70, 0x6E, 0x6E, 0x6E, 0x6E, 0x71,
-					0x6D, 0x70, 0x70, 0x6E, 0x6E, 0x6E, 0x71,
-					0x6D, 0x70, 0x70, 0x70, 0x6E, 0x6E, 0x71,
-					0x6D, 0x70, 0x70, 0x70, 0x70, 0x6E, 0x71,
-					0x6D, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71,
-					0x6D, 0x70, 0x70, 0x70, 0x70, 0x70, 0x73,
-				};
-				for (uint32_t c=0; c<7; c++) {
-					sdd1306.PlaceCustomChar(c+x,y,val_to_chr[val*7+c]+1);
-				}
-			} else {
-				const uint8_t val_to_chr[7*14] = {
-					0x6B, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x71,
-					0x6C, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x71,
-					0x6D, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E, 0x71,
-					0x6D, 0x70, 0x6E, 0x6E, 0x6E, 0x6E, 0x71,
-					0x6D, 0x70, 0x70, 0x6E, 0x6E, 0x6E, 0x71,
-					0x6D, 0x70, 0x70, 0x6E, 0x6E, 0x6E, 0x71,
-					0x6D, 0x70, 0x70, 0x6F, 0x6E, 0x6E, 0x71,
-					0x6D, 0x70, 0x70, 0x70, 0x6E, 0x6E, 0x71,
-					0x6D, 0x70, 0x70, 0x70, 0x6F, 0x6E, 0x71,
-					0x6D, 0x70, 0x70, 0x70, 0x70, 0x6E, 0x71,
-					0x6D, 0x70, 0x70, 0x70, 0x70, 0x6F, 0x71,
-					0x6D, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71,
-					0x6D, 0x70, 0x70, 0x70, 0x70, 0x70, 0x72,
-					0x6D, 0x70, 0x70, 0x70, 0x70, 0x70, 0x73,
-				};
-				for (uint32_t c=0; c<7; c++) {
-					sdd1306.PlaceCustomChar(c+x,y,val_to_chr[val*7+c]+1);
-				}
+#ifdef ENABLE_ASSET_STORE
+			uint8_t val_to_chr[ASSET_RECORD_SIZE];
+			AssetStore::Record((range == 0 ? ASSET_BAR8 : ASSET_BAR14) + val*7, val_to_chr);
+#else  // #ifdef ENABLE_ASSET_STORE
+			const uint8_t *val_to_chr = (range == 0 ? bar_chr_8 : bar_chr_14) + val*7;
+#endif  // #ifdef ENABLE_ASSET_STORE
+			for (uint32_t c=0; c<7; c++) {
+				sdd1306.PlaceCustomChar(c+x,y,val_to_chr[c]+1);
 			}
 		}
 	}
@@ -4968,26 +7274,25 @@ public:
 		return charge;
 	}
 
+	void SampleBattery() {
+		battery_sample_ms = system_clock_ms;
+		uint8_t stat = bq24295.GetStatus();
+		bool bad = BadConnection() != 0;
+		if (stat != bat_stat || bad != bad_connection) {
+			bat_stat = stat;
+			bad_connection = bad;
+			ui_invalid |= UI_INVALID_BATTERY;
+		}
+	}
+
 	void DisplayStatus() {
-		sdd1306.PlaceCustomChar(0,0,0xA9);
-		sdd1306.PlaceCustomChar(1,0,0xAA);
-		sdd1306.PlaceCustomChar(2,0,0xAB);
-		sdd1306.PlaceCustomChar(3,0,0xAC);
-		sdd1306.PlaceCustomChar(4,0,0xAD);
-		sdd1306.PlaceCustomChar(5,0,0xAE);
-		sdd1306.PlaceCustomChar(6,0,0xAF);
-		sdd1306.PlaceCustomChar(7,0,0xA0+(system_clock_ms/0x400)%8);
-		sdd1306.PlaceCustomChar(0,1,0x66);
+		sdd1306.PlaceCustomChar(7,0,0xA0+clock_glyph);
 		DisplayBar(1,1,7,uint8_t(settings.brightness), 0);
-		sdd1306.PlaceCustomChar(0,2,0x68);
 		char str[9];
 		sprintf(str,"[%02d/%02d]",settings.program_curr + 1,settings.program_count);
 		sdd1306.PlaceAsciiStr(1,2,str);
 
-
-		sdd1306.PlaceCustomChar(0,3,0x67);
-		uint8_t bat_stat = bq24295.GetStatus();
-		if (BadConnection()) {
+		if (bad_connection) {
 			sdd1306.PlaceAsciiStr(1,3,"BATERR!");
 		} else {
 			sdd1306.PlaceCustomChar(1,3,(bat_stat & 0x01) ? 0x289 : 0x288);
@@ -5001,22 +7306,18 @@ public:
 
 		sdd1306.Display();
 	}
+
+	void StatusHandler(bool top_pressed, bool bottom_pressed) {
+		if (top_pressed) {
+			settings.NextEffect();
+		}
+		if (bottom_pressed) {
+			settings.NextBrightness();
+		}
+	}
 	
 	void DisplaySettings() {
-		sdd1306.PlaceCustomChar(0,0,0x7C);
-		sdd1306.PlaceCustomChar(1,0,0x149);
-		sdd1306.PlaceCustomChar(2,0,0x14A);
-		sdd1306.PlaceCustomChar(3,0,0x14B);
-		sdd1306.PlaceCustomChar(4,0,0x14C);
-		sdd1306.PlaceCustomChar(5,0,0x14D);
-		sdd1306.PlaceCustomChar(6,0,0x14E);
-		sdd1306.PlaceCustomChar(7,0,0x14F);
-		if (menu_selection == 0) {
-			sdd1306.SetAttr(0,0,1);
-		} else {
-			sdd1306.SetAttr(0,0,0);
-		}
-		const char *menu[] = {
+		static const char *const items[] = {
 			"1COLORS ",
 			"2RADIO  ",
 			"3HISTORY",
@@ -5025,72 +7326,52 @@ public:
 			"6TEST   ",
 			"7VERSION",
 		};
-		for (int32_t c=0; c<3; c++) {
-			sdd1306.PlaceAsciiStr(0,c+1,menu[c+menu_scroll]);
-			if (menu_selection == c+1+menu_scroll) {
-				sdd1306.SetAttr(0,c+1,1);
-			} else {
-				sdd1306.SetAttr(0,c+1,0);
-			}
-		}
+		MenuList(items);
+		MenuHighlight(menu.selection ? menu.selection - menu.scroll : 0);
 		sdd1306.Display();
 	}
 	
 	void SettingsHandler(bool top_pressed, bool bottom_pressed) {
 		if (top_pressed) {
-			menu_selection++;
-			if (menu_selection > max_menu) {
-				menu_selection = 0;
-				menu_scroll = 0;
-			}
-			if (menu_selection > 3) {
-				menu_scroll = menu_selection - 3;
-			}
+			MenuNext(8);
 		}
 		if (bottom_pressed) {
-			switch (menu_selection) { 
+			switch (menu.selection) { 
 				case	0: {
-							menu_scroll = 0;
-							menu_selection = 0;
 							SetMode(system_clock_ms, 0);
 							return;
 						} break;
 				case	1: {
-							menu_scroll = 0;
-							menu_selection = 0;
 							SetMode(system_clock_ms, 3);
 							return;
 						} break;
 				case	2: {
-							menu_scroll = 0;
-							menu_selection = 0;
 							SetMode(system_clock_ms, 4);
 							return;
 						} break;
 				case	3: {
-							menu_scroll = 0;
-							menu_selection = 0;
 							SetMode(system_clock_ms, 10);
 							return;
 						} break;
 				case	4: {
-							menu_scroll = 0;
-							menu_selection = 0;
 							SetMode(system_clock_ms, 9);
 							return;
 						} break;
 				case	5: {
 							settings.Reset(false);
 							EEPROM::loaded = false;
+							warm_state.Invalidate();
 							NVIC_SystemReset();
 						} break;
 				case	6: {
 							sdd1306.ClearAttr();
 							DisplayTest();
+							PlaceStatic();
 						} break;
 				case	7: {
 							sdd1306.ClearAttr();
 							DisplayVersion();
+							PlaceStatic();
 						} break;
 			}
 		}
@@ -5098,77 +7379,19 @@ public:
 	}
 
 	void DisplayRGB() {
-		
-		sdd1306.SetAttr(0,0,0);
-		sdd1306.SetAttr(0,1,0);
-		sdd1306.SetAttr(0,2,0);
-		sdd1306.SetAttr(0,3,0);
-		
-		switch (rgb_selection) {
-			case	0: {
-						sdd1306.SetAttr(0,0,1);
-					} break;
-			case	1: {
-					} break;
-			case	2: {
-						sdd1306.SetAttr(0,1,1);
-					} break;
-			case	3: {
-						sdd1306.SetAttr(0,2,1);
-					} break;
-			case	4: {
-						sdd1306.SetAttr(0,3,1);
-					} break;
-		}
-		
-		sdd1306.PlaceCustomChar(0,0,0x7C);
-		
-		if (rgb_selection == 1) {
-			if (ring_or_duck) {
-				sdd1306.PlaceCustomChar(1,0,0x157);
-				sdd1306.PlaceCustomChar(2,0,0x158);
-				sdd1306.PlaceCustomChar(3,0,0x159);
-				sdd1306.PlaceCustomChar(4,0,0x15A);
-				sdd1306.PlaceCustomChar(5,0,0x15B);
-				sdd1306.PlaceCustomChar(6,0,0x15C);
-				sdd1306.PlaceCustomChar(7,0,0x15D);
-			} else {
-				sdd1306.PlaceCustomChar(1,0,0x150);
-				sdd1306.PlaceCustomChar(2,0,0x151);
-				sdd1306.PlaceCustomChar(3,0,0x152);
-				sdd1306.PlaceCustomChar(4,0,0x153);
-				sdd1306.PlaceCustomChar(5,0,0x154);
-				sdd1306.PlaceCustomChar(6,0,0x155);
-				sdd1306.PlaceCustomChar(7,0,0x156);
-			}
+		bool duck = menu.item != 0;
+
+		MenuHighlight(menu.selection == 1 ? -1 : (menu.selection ? menu.selection - 1 : 0));
+
+		if (menu.selection == 1) {
+			PlaceGlyphs(1,0,duck ? 0x157 : 0x150,7);
 		} else {
-			if (ring_or_duck) {
-				sdd1306.PlaceCustomChar(1,0,0x15E);
-				sdd1306.PlaceCustomChar(2,0,0x15F);
-				sdd1306.PlaceCustomChar(3,0,0x160);
-				sdd1306.PlaceCustomChar(4,0,0x161);
-				sdd1306.PlaceCustomChar(5,0,0x162);
-				sdd1306.PlaceCustomChar(6,0,0x163);
-				sdd1306.PlaceCustomChar(7,0,0x164);
-			} else {
-				sdd1306.PlaceCustomChar(1,0,0x165);
-				sdd1306.PlaceCustomChar(2,0,0x166);
-				sdd1306.PlaceCustomChar(3,0,0x167);
-				sdd1306.PlaceCustomChar(4,0,0x168);
-				sdd1306.PlaceCustomChar(5,0,0x169);
-				sdd1306.PlaceCustomChar(6,0,0x16A);
-				sdd1306.PlaceCustomChar(7,0,0x16B);
-			}
+			PlaceGlyphs(1,0,duck ? 0x15E : 0x165,7);
 		}
 		
-		sdd1306.PlaceCustomChar(0,1,0x69);
-		DisplayBar(1,1,7,uint8_t(ring_or_duck ? settings.ring_color.r()/16 : settings.bird_color.r()/16), 0);
-
-		sdd1306.PlaceCustomChar(0,2,0x6A);
-		DisplayBar(1,2,7,uint8_t(ring_or_duck ? settings.ring_color.g()/16 : settings.bird_color.g()/16), 0);
-
-		sdd1306.PlaceCustomChar(0,3,0x6B);
-		DisplayBar(1,3,7,uint8_t(ring_or_duck ? settings.ring_color.b()/16 : settings.bird_color.b()/16), 0);
+		DisplayBar(1,1,7,uint8_t(duck ? settings.ring_color.r()/16 : settings.bird_color.r()/16), 0);
+		DisplayBar(1,2,7,uint8_t(duck ? settings.ring_color.g()/16 : settings.bird_color.g()/16), 0);
+		DisplayBar(1,3,7,uint8_t(duck ? settings.ring_color.b()/16 : settings.bird_color.b()/16), 0);
 
 		sdd1306.Display();
 	}
@@ -5176,52 +7399,30 @@ public:
 	
 	void RGBGHandler(bool top_pressed, bool bottom_pressed) {
 		if (top_pressed) {
-			rgb_selection ++;
-			if (rgb_selection > 4) {
-				rgb_selection = 0;
-			}
+			MenuNext(5);
 		}
 		if (bottom_pressed) {
-			switch (rgb_selection) { 
+			rgba &color = menu.item ? settings.ring_color : settings.bird_color;
+			switch (menu.selection) { 
 				case	0: {
-							rgb_selection = 0;
 							SetMode(system_clock_ms, 0);
 							settings.Save();
 							return;
 						} break;
 				case	1: {
-							if (ring_or_duck) {
-								ring_or_duck = false;
-							} else {
-								ring_or_duck = true;
-							}
+							menu.item = !menu.item;
 						} break;
 				case	2: {
-							if (ring_or_duck) {
-								uint8_t r = settings.ring_color.r() + 4; if (r >= 0x80) r = 0;
-								settings.ring_color = rgba(r,settings.ring_color.g()+0,settings.ring_color.b()+0);
-							} else {
-								uint8_t r = settings.bird_color.r() + 4; if (r >= 0x80) r = 0;
-								settings.bird_color = rgba(r,settings.bird_color.g()+0,settings.bird_color.b()+0);
-							}
+							uint8_t r = color.r() + 4; if (r >= 0x80) r = 0;
+							color = rgba(r,color.g()+0,color.b()+0);
 						} break;
 				case	3: {
-							if (ring_or_duck) {
-								uint8_t g = settings.ring_color.g() + 4; if (g >= 0x80) g = 0;
-								settings.ring_color = rgba(settings.ring_color.r()+0,g,settings.ring_color.b()+0);
-							} else {
-								uint8_t g = settings.bird_color.g() + 4; if (g >= 0x80) g = 0;
-								settings.bird_color = rgba(settings.bird_color.r()+0,g,settings.bird_color.b()+0);
-							}
+							uint8_t g = color.g() + 4; if (g >= 0x80) g = 0;
+							color = rgba(color.r()+0,g,color.b()+0);
 						} break;
 				case	4: {
-							if (ring_or_duck) {
-								uint8_t b = settings.ring_color.b() + 4; if (b >= 0x80) b = 0;
-								settings.ring_color = rgba(settings.ring_color.r()+0,settings.ring_color.g()+0,b);
-							} else {
-								uint8_t b = settings.bird_color.b() + 4; if (b >= 0x80) b = 0;
-								settings.bird_color = rgba(settings.bird_color.r()+0,settings.bird_color.g()+0,b);
-							}
+							uint8_t b = color.b() + 4; if (b >= 0x80) b = 0;
+							color = rgba(color.r()+0,color.g()+0,b);
 						} break;
 			}
 		}
@@ -5229,68 +7430,26 @@ public:
 	}
 
 	void DisplayRadioSettings() {
-		sdd1306.SetAttr(0,0,0);
-		sdd1306.SetAttr(0,1,0);
-		sdd1306.SetAttr(0,2,0);
-		sdd1306.SetAttr(0,3,0); 
-		sdd1306.SetAttr(0,radio_settings_selection,1);
-		
-		sdd1306.PlaceCustomChar(0,0,0x7C);
-		sdd1306.PlaceCustomChar(1,0,0x17A);
-		sdd1306.PlaceCustomChar(2,0,0x17B);
-		sdd1306.PlaceCustomChar(3,0,0x17C);
-		sdd1306.PlaceCustomChar(4,0,0x17D);
-		sdd1306.PlaceCustomChar(5,0,0x17E);
-		sdd1306.PlaceCustomChar(6,0,0x17F);
-		sdd1306.PlaceCustomChar(7,0,0x180);
-
-		const char *menu[] = {
+		static const char *const items[] = {
 			"1       ",
 			"2NAME   ",
 			"3MESSAGE",
 		};
-		
-		for (int32_t c=0; c<3; c++) {
-			sdd1306.PlaceAsciiStr(0,c+1,menu[c]);
-			if (radio_settings_selection == c+1) {
-				sdd1306.SetAttr(0,c+1,1);
-			} else {
-				sdd1306.SetAttr(0,c+1,0);
-			}
-		}
+		MenuList(items);
+		MenuHighlight(menu.selection);
 
-		if (settings.radio_enabled) {
-			sdd1306.PlaceCustomChar(1,1,0x16C);
-			sdd1306.PlaceCustomChar(2,1,0x16D);
-			sdd1306.PlaceCustomChar(3,1,0x16E);
-			sdd1306.PlaceCustomChar(4,1,0x16F);
-			sdd1306.PlaceCustomChar(5,1,0x170);
-			sdd1306.PlaceCustomChar(6,1,0x171);
-			sdd1306.PlaceCustomChar(7,1,0x172);
-		} else {
-			sdd1306.PlaceCustomChar(1,1,0x173);
-			sdd1306.PlaceCustomChar(2,1,0x174);
-			sdd1306.PlaceCustomChar(3,1,0x175);
-			sdd1306.PlaceCustomChar(4,1,0x176);
-			sdd1306.PlaceCustomChar(5,1,0x177);
-			sdd1306.PlaceCustomChar(6,1,0x178);
-			sdd1306.PlaceCustomChar(7,1,0x179);
-		}
+		PlaceGlyphs(1,1,settings.radio_enabled ? 0x16C : 0x173,7);
 
 		sdd1306.Display();
 	}
 
 	void RadioSettingsHandler(bool top_pressed, bool bottom_pressed) {
 		if (top_pressed) {
-			radio_settings_selection ++;
-			if (radio_settings_selection > 3) {
-				radio_settings_selection = 0;
-			}
+			MenuNext(4);
 		}
 		if (bottom_pressed) {
-			switch (radio_settings_selection) { 
+			switch (menu.selection) { 
 				case	0: {
-							radio_settings_selection = 0;
 							SetMode(system_clock_ms, 0);
 							settings.Save();
 							return;
@@ -5303,12 +7462,10 @@ public:
 							}
 						} break;
 				case	2: {
-							radio_settings_selection = 0;
 							SetMode(system_clock_ms, 7);
 							return;
 						} break;
 				case	3: {
-							radio_settings_selection = 0;
 							SetMode(system_clock_ms, 8);
 							return;
 						} break;
@@ -5319,10 +7476,7 @@ public:
 
 	void DisplayRadio() {
 		
-		sdd1306.SetAttr(0,1,0);
-		sdd1306.SetAttr(0,2,0);
-		sdd1306.SetAttr(0,3,0); 
-		sdd1306.SetAttr(0,radio_selection+1,1);
+		MenuHighlight(menu.selection+1);
 		
 		if (settings.radio_message >= 8) {
 			settings.radio_message = 0;
@@ -5337,31 +7491,11 @@ public:
 		memcpy(str,settings.radio_messages[settings.radio_message],8);
 		sdd1306.PlaceAsciiStr(0,0,str);
 
-		sdd1306.PlaceCustomChar(0,1,0x193);
-		
-		if (radio_selection == 0) {
-			sdd1306.PlaceCustomChar(1,1,0x19B);
-			sdd1306.PlaceCustomChar(2,1,0x19C);
-			sdd1306.PlaceCustomChar(3,1,0x19D);
-			sdd1306.PlaceCustomChar(4,1,0x19E);
-			sdd1306.PlaceCustomChar(5,1,0x19F);
-			sdd1306.PlaceCustomChar(6,1,0x1A0);
-			sdd1306.PlaceCustomChar(7,1,0x1A1);
-		} else {
-			sdd1306.PlaceCustomChar(1,1,0x194);
-			sdd1306.PlaceCustomChar(2,1,0x195);
-			sdd1306.PlaceCustomChar(3,1,0x196);
-			sdd1306.PlaceCustomChar(4,1,0x197);
-			sdd1306.PlaceCustomChar(5,1,0x198);
-			sdd1306.PlaceCustomChar(6,1,0x199);
-			sdd1306.PlaceCustomChar(7,1,0x19A);
-		}
+		PlaceGlyphs(1,1,(menu.selection == 0) ? 0x19B : 0x194,7);
 
-		sdd1306.PlaceCustomChar(0,2,0x191);
 		sprintf(str,"[%02d/%02d]",settings.radio_message + 1,8);
 		sdd1306.PlaceAsciiStr(1,2,str);
 
-		sdd1306.PlaceCustomChar(0,3,0x192);
 		sprintf(str,"[%02d/%02d]",settings.radio_color + 1,11);
 		sdd1306.PlaceAsciiStr(1,3,str);
 
@@ -5370,17 +7504,12 @@ public:
 	
 	void RadioHandler(bool top_pressed, bool bottom_pressed) {
 		if (top_pressed) {
-			radio_selection ++;
-			if (radio_selection > 2) {
-				radio_selection = 0;
-			}
+			MenuNext(3);
 		}
 		if (bottom_pressed) {
-			switch (radio_selection) { 
+			switch (menu.selection) { 
 				case	0: {
 							sx1280.SendMessage();
-							radio_selection = 0;
-							sdd1306.ClearAttr();
 							SetMode(system_clock_ms, 0);
 							settings.Save();
 							return;
@@ -5403,7 +7532,6 @@ public:
 	}
 
 	void DisplayMessage() {
-		static int32_t scroll_x = 0;
 		if ((system_clock_ms - mode_start_time) < 50) {
 			for (int32_t c=0; c<8; c++) {
 				sdd1306.PlaceCustomChar(c,0,0x181+c);
@@ -5413,79 +7541,20 @@ public:
 				sdd1306.PlaceCustomChar(c,2,0x280+c);
 			}
 			
-			char str[9];
-			memset(str,0,9);
-			memcpy(str,settings.recv_radio_name,8);
-			sdd1306.PlaceAsciiStr(0,3,str);
-
-			sdd1306.SetAsciiScrollMessage(settings.recv_radio_message, scroll_x++);
-
-			sdd1306.SetVerticalShift(0);
-		}
-		else if ((system_clock_ms - mode_start_time) < 50 + 640 + 50) {
-			uint32_t ltime = (system_clock_ms - mode_start_time) - 50;
-			static uint8_t bounce[] = {
-				0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x1d, 0x1d, 
-				0x1c, 0x1b, 0x1a, 0x18, 0x17, 0x16, 0x14, 0x12, 
-				0x10, 0x0e, 0x0c, 0x0a, 0x08, 0x05, 0x03, 0x01, 
-				0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 
-				0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x07, 
-				0x06, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x01, 
-				0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-				0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 
-			};
-			uint32_t y = ltime/10;
-			if (y >= 64) y = 63;
-
-			sdd1306.SetAsciiScrollMessage(settings.recv_radio_message, scroll_x++);
-
-			sdd1306.Display();
-			sdd1306.SetVerticalShift(bounce[y]);
-		}
-		else if ((system_clock_ms - mode_start_time) < 5000 + 50 + 640 + 50) {
-			sdd1306.SetAsciiScrollMessage(settings.recv_radio_message, scroll_x++);
-			sdd1306.Display();
+			char str[9];
+			memset(str,0,9);
+			memcpy(str,settings.recv_radio_name,8);
+			sdd1306.PlaceAsciiStr(0,3,str);
 		}
-		else if ((system_clock_ms - mode_start_time) < 160 + 5000 + 50 + 640 + 50) {
-			uint32_t ltime = (system_clock_ms - mode_start_time) - (5000 + 50 + 640 + 50);
-			static int8_t ease[] = {
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 
-				0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 
-				0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0e, 0x0f, 0x11, 
-				0x12, 0x14, 0x15, 0x17, 0x19, 0x1b, 0x1d, 0x1f, 
-				0x1f,
-			};
-			sdd1306.SetVerticalShift(-ease[ltime/5]);
-			sdd1306.SetCenterFlip(ltime/5);
-			sdd1306.Display();
-		} else {
-			sdd1306.SetAsciiScrollMessage(0, 0);
-			mode = previous_mode;
-			sdd1306.ClearAttr();
-			DisplayStatus();
-			sdd1306.SetVerticalShift(0);
-			sdd1306.SetCenterFlip(0);
-			sdd1306.Display();
+		sdd1306.SetAsciiScrollMessage(settings.recv_radio_message);
+		if (!PlayTimeline(timeline_message)) {
+			sdd1306.SetAsciiScrollMessage(0);
+			FinishInterlude();
 		}
 	}
 	
 	void DisplayNameSettings() {
-		if ( radio_name_selection == 0 ) {
-			sdd1306.SetAttr(0,0,1);
-		} else {
-			sdd1306.SetAttr(0,0,0);
-		}
-		
-		sdd1306.PlaceCustomChar(0,0,0x7C);
-		sdd1306.PlaceCustomChar(1,0,0x1A2);
-		sdd1306.PlaceCustomChar(2,0,0x1A3);
-		sdd1306.PlaceCustomChar(3,0,0x1A4);
-		sdd1306.PlaceCustomChar(4,0,0x1A5);
-		sdd1306.PlaceCustomChar(5,0,0x1A6);
-		sdd1306.PlaceCustomChar(6,0,0x1A7);
-		sdd1306.PlaceCustomChar(7,0,0x1A8);
-		
-		sdd1306.PlaceAsciiStr(0,1,"        ");
+		MenuHighlight(menu.selection == 0 ? 0 : -1);
 		
 		char str[9];
 		memset(str,0,sizeof(str));
@@ -5494,8 +7563,8 @@ public:
 
 		sdd1306.PlaceAsciiStr(0,3,"        ");
 		
-		if (radio_name_selection > 0) {
-			sdd1306.PlaceCustomChar(radio_name_selection - 1,3,0x1B0);
+		if (menu.selection > 0) {
+			sdd1306.PlaceCustomChar(menu.selection - 1,3,0x1B0);
 		}
 
 		sdd1306.Display();
@@ -5503,28 +7572,23 @@ public:
 
 	void NameSettingsHandler(bool top_pressed, bool bottom_pressed) {
 		if (top_pressed) {
-			radio_name_selection ++;
-			if (radio_name_selection >= 9) {
-				radio_name_selection = 0;
-			}
+			MenuNext(9);
 		}
 		if (bottom_pressed) {
-			switch (radio_name_selection) { 
+			switch (menu.selection) { 
 				case	0: {
-							radio_name_selection = 0;
 							SetMode(system_clock_ms, 0);
-							sdd1306.ClearAttr();
 							settings.Save();
 							return;
 						} break;
 				default: {
-							if (settings.radio_name[radio_name_selection - 1] < 0x20 ||
-								settings.radio_name[radio_name_selection - 1] > 0x60) {
-								settings.radio_name[radio_name_selection - 1] = 0x20;
+							if (settings.radio_name[menu.selection - 1] < 0x20 ||
+								settings.radio_name[menu.selection - 1] > 0x60) {
+								settings.radio_name[menu.selection - 1] = 0x20;
 							}
-							settings.radio_name[radio_name_selection - 1] ++;
-							if (settings.radio_name[radio_name_selection - 1] >= 0x60) {
-								settings.radio_name[radio_name_selection - 1] = 0x20;
+							settings.radio_name[menu.selection - 1] ++;
+							if (settings.radio_name[menu.selection - 1] >= 0x60) {
+								settings.radio_name[menu.selection - 1] = 0x20;
 							}
 						} break;
 			}
@@ -5534,40 +7598,20 @@ public:
 
 	void DisplayMessageSettings() {
 		
-		if ( radio_message_selection == 0 ) {
-			sdd1306.SetAttr(0,0,1);
-		} else {
-			sdd1306.SetAttr(0,0,0);
-		}
-
-		if ( radio_message_selection == 1 ) {
-			sdd1306.SetAttr(0,1,1);
-		} else {
-			sdd1306.SetAttr(0,1,0);
-		}
-		
-		sdd1306.PlaceCustomChar(0,0,0x7C);
-		sdd1306.PlaceCustomChar(1,0,0x1A9);
-		sdd1306.PlaceCustomChar(2,0,0x1AA);
-		sdd1306.PlaceCustomChar(3,0,0x1AB);
-		sdd1306.PlaceCustomChar(4,0,0x1AC);
-		sdd1306.PlaceCustomChar(5,0,0x1AD);
-		sdd1306.PlaceCustomChar(6,0,0x1AE);
-		sdd1306.PlaceCustomChar(7,0,0x1AF);
+		MenuHighlight(menu.selection <= 1 ? menu.selection : -1);
 		
 		char str[9];
-		sdd1306.PlaceCustomChar(0,1,0x191);
-		sprintf(str,"[%02d/%02d]",radio_message_current + 1,8);
+		sprintf(str,"[%02d/%02d]",int(menu.item) + 1,8);
 		sdd1306.PlaceAsciiStr(1,1,str);
 		
 		memset(str,0,sizeof(str));
-		memcpy(str,settings.radio_messages[radio_message_current],8);
+		memcpy(str,settings.radio_messages[menu.item],8);
 		sdd1306.PlaceAsciiStr(0,2,str);
 
 		sdd1306.PlaceAsciiStr(0,3,"        ");
 		
-		if (radio_message_selection > 0) {
-			sdd1306.PlaceCustomChar(radio_message_selection - 2,3,0x1B0);
+		if (menu.selection > 0) {
+			sdd1306.PlaceCustomChar(menu.selection - 2,3,0x1B0);
 		}
 
 		sdd1306.Display();
@@ -5575,34 +7619,30 @@ public:
 
 	void MessageSettingsHandler(bool top_pressed, bool bottom_pressed) {
 		if (top_pressed) {
-			radio_message_selection ++;
-			if (radio_message_selection >= 10) {
-				radio_message_selection = 0;
-			}
+			MenuNext(10);
 		}
 		if (bottom_pressed) {
-			switch (radio_message_selection) { 
+			char *message = settings.radio_messages[menu.item];
+			switch (menu.selection) { 
 				case	0: {
-							radio_message_selection = 0;
-							radio_message_current = 0;
 							SetMode(system_clock_ms, 0);
 							settings.Save();
 							return;
 						} break;
 				case	1: {
-							radio_message_current ++;
-							if (radio_message_current >= 8) {
-								radio_message_current = 0;
+							menu.item ++;
+							if (menu.item >= 8) {
+								menu.item = 0;
 							}
 						} break;
 				default: {
-							if (settings.radio_messages[radio_message_current][radio_message_selection - 1] < 0x20 ||
-								settings.radio_messages[radio_message_current][radio_message_selection - 1] > 0x60) {
-								settings.radio_messages[radio_message_current][radio_message_selection - 1] = 0x20;
+							if (message[menu.selection - 1] < 0x20 ||
+								message[menu.selection - 1] > 0x60) {
+								message[menu.selection - 1] = 0x20;
 							}
-							settings.radio_messages[radio_message_current][radio_message_selection - 2] ++;
-							if (settings.radio_messages[radio_message_current][radio_message_selection - 2] >= 0x40) {
-								settings.radio_messages[radio_message_current][radio_message_selection - 2] = 0x20;
+							message[menu.selection - 2] ++;
+							if (message[menu.selection - 2] >= 0x40) {
+								message[menu.selection - 2] = 0x20;
 							}
 						} break;
 			}
@@ -5752,34 +7792,13 @@ public:
 	}
 	
 	void DisplayStats() {
-		if ( stats_menu_selection == 0 ) {
-			sdd1306.SetAttr(0,0,1);
-		} else {
-			sdd1306.SetAttr(0,0,0);
-		}
-
-		if ( stats_menu_selection == 1 ) {
-			sdd1306.SetAttr(0,1,1);
-		} else {
-			sdd1306.SetAttr(0,1,0);
-		}
-		
-		sdd1306.PlaceCustomChar(0,0,0x7C);
-		sdd1306.PlaceCustomChar(1,0,0x1C7);
-		sdd1306.PlaceCustomChar(2,0,0x1C8);
-		sdd1306.PlaceCustomChar(3,0,0x1C9);
-		sdd1306.PlaceCustomChar(4,0,0x1CA);
-		sdd1306.PlaceCustomChar(5,0,0x1CB);
-		sdd1306.PlaceCustomChar(6,0,0x1CC);
-		sdd1306.PlaceCustomChar(7,0,0x1CD);
-		
+		MenuHighlight(menu.selection);
 		
 		char str[9];
-		sdd1306.PlaceCustomChar(0,1,0x68);
-		sprintf(str,"[%02d/%02d]",stats_select_current + 1,8);
+		sprintf(str,"[%02d/%02d]",int(menu.item) + 1,8);
 		sdd1306.PlaceAsciiStr(1,1,str);
 
-		switch(stats_select_current) {
+		switch(menu.item) {
 			case	0: {
 						sdd1306.PlaceAsciiStr(0,2,"PRG CHNG");
 						if (settings.program_change_count > 99999999) {
@@ -5828,31 +7847,40 @@ public:
 							sdd1306.PlaceAsciiStr(0,3,str);
 						}
 					} break;
+			case	5: {
+						sdd1306.PlaceAsciiStr(0,2,"WARM RST");
+						sprintf(str,"%08d",warm_state.warm_resume_count);
+						sdd1306.PlaceAsciiStr(0,3,str);
+					} break;
+			case	6: {
+						sdd1306.PlaceAsciiStr(0,2,"FREE STK");
+						sprintf(str,"%08d",StackMonitor::MinFree());
+						sdd1306.PlaceAsciiStr(0,3,str);
+					} break;
+			case	7: {
+						sdd1306.PlaceAsciiStr(0,2,"EFX STK ");
+						sprintf(str,"%08d",StackMonitor::EffectPeak(settings.program_curr));
+						sdd1306.PlaceAsciiStr(0,3,str);
+					} break;
 		}
 		sdd1306.Display();
 	}
 
 	void StatsHandler(bool top_pressed, bool bottom_pressed) {
 		if (top_pressed) {
-			stats_menu_selection ++;
-			if (stats_menu_selection >= 2) {
-				stats_menu_selection = 0;
-			}
+			MenuNext(2);
 		}
 		if (bottom_pressed) {
-			switch (stats_menu_selection) { 
+			switch (menu.selection) { 
 				case	0: {
-							stats_select_current = 0;
-							stats_menu_selection = 0;
-							sdd1306.ClearAttr();
 							SetMode(system_clock_ms, 0);
 							settings.Save();
 							return;
 						} break;
 				case	1: {
-							stats_select_current ++;
-							if (stats_select_current >= 5) {
-								stats_select_current = 0;
+							menu.item ++;
+							if (menu.item >= 8) {
+								menu.item = 0;
 							}
 						} break;
 			}
@@ -5861,34 +7889,14 @@ public:
 	}
 	
 	void DisplayHistory() {
-		if ( history_menu_selection == 0 ) {
-			sdd1306.SetAttr(0,0,1);
-		} else {
-			sdd1306.SetAttr(0,0,0);
-		}
+		MenuHighlight(menu.selection);
 
-		if ( history_menu_selection == 1 ) {
-			sdd1306.SetAttr(0,1,1);
-		} else {
-			sdd1306.SetAttr(0,1,0);
-		}
-		
-		sdd1306.PlaceCustomChar(0,0,0x7C);
-		sdd1306.PlaceCustomChar(1,0,0x1CE);
-		sdd1306.PlaceCustomChar(2,0,0x1CF);
-		sdd1306.PlaceCustomChar(3,0,0x1D0);
-		sdd1306.PlaceCustomChar(4,0,0x1D1);
-		sdd1306.PlaceCustomChar(5,0,0x1D2);
-		sdd1306.PlaceCustomChar(6,0,0x1D3);
-		sdd1306.PlaceCustomChar(7,0,0x1D4);
-
-		sdd1306.PlaceCustomChar(0,1,0x191);
 		char str[9];
-		sprintf(str,"%03d/%03d", history_select_current + 1, settings.GetMessageCount());
+		sprintf(str,"%03d/%03d", int(menu.item) + 1, settings.GetMessageCount());
 		sdd1306.PlaceAsciiStr(1,1,str);
 		
 		uint8_t msg[32];
-		if (settings.GetMessage(ft25h16s, history_select_current, &msg[0])) {
+		if (settings.GetMessage(ft25h16s, menu.item, &msg[0])) {
 			settings.recv_radio_color = msg[7];
 			memset(str,0,9);
 			strncpy(str,(const char *)&msg[8],8);
@@ -5905,25 +7913,19 @@ public:
 
 	void HistoryHandler(bool top_pressed, bool bottom_pressed) {
 		if (top_pressed && settings.GetMessageCount()) {
-			history_menu_selection ++;
-			if (history_menu_selection >= 2) {
-				history_menu_selection = 0;
-			}
+			MenuNext(2);
 		}
 		if (bottom_pressed) {
-			switch (history_menu_selection) { 
+			switch (menu.selection) { 
 				case	0: {
-							history_select_current = 0;
-							history_menu_selection = 0;
-							sdd1306.ClearAttr();
 							SetMode(system_clock_ms, 0);
 							settings.Save();
 							return;
 						} break;
 				case	1: {
-							history_select_current ++;
-							if (history_select_current >= settings.GetMessageCount()) {
-								history_select_current = 0;
+							menu.item ++;
+							if (menu.item >= int32_t(settings.GetMessageCount())) {
+								menu.item = 0;
 							}
 						} break;
 			}
@@ -5932,51 +7934,68 @@ public:
 	}
 
 	void Display() {
-		switch (mode) {
-			case	0:
-					DisplayStatus();
-					break;
-			case	1:
-					switch(interlude) {
-						case 	0:
-								DisplayNow();
-								break;
-						case 	1:
-								DisplayDog();
-								break;
-					}
-					break;
-			case	2:
-					DisplaySettings();
-					break;
-			case	3:
-					DisplayRGB();
-					break;
-			case	4:
-					DisplayRadioSettings();
-					break;
-			case	5:
-					DisplayRadio();
-					break;
-			case	6:
-					DisplayMessage();
-					break;
-			case	7:
-					DisplayNameSettings();
-					break;
-			case	8:
-					DisplayMessageSettings();
-					break;
-			case	9:
-					DisplayStats();
-					break;
-			case	10:
-					DisplayHistory();
-					break;
+		(this->*screens[mode].render)();
+	}
+
+	// Called whenever the effect loop waits for its next frame. Static
+	// screens are only redrawn after something invalidated them, animated
+	// ones at UI_FRAME_MS no matter how fast or slow the effect runs.
+	void Update() {
+		const Screen &screen = screens[mode];
+		if ((screen.invalid & UI_INVALID_BATTERY)) {
+			if ((system_clock_ms - battery_sample_ms) >= UI_BATTERY_MS) {
+				SampleBattery();
+			}
+			uint32_t glyph = (system_clock_ms/0x400)%8;
+			if (glyph != clock_glyph) {
+				clock_glyph = glyph;
+				ui_invalid |= UI_INVALID_CLOCK;
+			}
+		}
+
+		bool redraw = false;
+		if (screen.refresh_ms && int32_t(system_clock_ms - next_frame_ms) >= 0) {
+			next_frame_ms = system_clock_ms + screen.refresh_ms;
+			redraw = true;
+		}
+		if (ui_invalid) {
+			__disable_irq();
+			uint32_t invalid = ui_invalid;
+			ui_invalid = 0;
+			__enable_irq();
+			// What other screens depend on gets redrawn when they are entered
+			if ((invalid & screen.invalid)) {
+				redraw = true;
+			}
+		}
+		if (!redraw) {
+			return;
 		}
+
+		Trace::Begin(Trace::DISPLAY, mode);
+		Display();
+		Trace::End(Trace::DISPLAY, sdd1306.DisplayTransactions());
+		i2c_bus.CaptureFrame();
 	}
 };
 
+const UI::Screen UI::screens[UI_MODE_COUNT] = {
+	// render, input, icons, title, invalid, refresh_ms
+	{ &UI::DisplayStatus, &UI::StatusHandler, { 0xA9, 0x66, 0x68, 0x67 }, 0xAA,
+	  UI_INVALID_MODE | UI_INVALID_SETTINGS | UI_INVALID_BATTERY | UI_INVALID_RADIO | UI_INVALID_CLOCK, 0 },
+	{ &UI::DisplayInterlude, 0, { 0, 0, 0, 0 }, 0, UI_INVALID_MODE, UI_FRAME_MS },
+	{ &UI::DisplaySettings, &UI::SettingsHandler, { 0x7C, 0, 0, 0 }, 0x149, UI_INVALID_MODE, 0 },
+	{ &UI::DisplayRGB, &UI::RGBGHandler, { 0x7C, 0x69, 0x6A, 0x6B }, 0, UI_INVALID_MODE | UI_INVALID_SETTINGS, 0 },
+	{ &UI::DisplayRadioSettings, &UI::RadioSettingsHandler, { 0x7C, 0, 0, 0 }, 0x17A, UI_INVALID_MODE | UI_INVALID_SETTINGS, 0 },
+	{ &UI::DisplayRadio, &UI::RadioHandler, { 0, 0x193, 0x191, 0x192 }, 0, UI_INVALID_MODE | UI_INVALID_SETTINGS, 0 },
+	{ &UI::DisplayMessage, 0, { 0, 0, 0, 0 }, 0, UI_INVALID_MODE, UI_FRAME_MS },
+	{ &UI::DisplayNameSettings, &UI::NameSettingsHandler, { 0x7C, 0, 0, 0 }, 0x1A2, UI_INVALID_MODE | UI_INVALID_SETTINGS, 0 },
+	{ &UI::DisplayMessageSettings, &UI::MessageSettingsHandler, { 0x7C, 0x191, 0, 0 }, 0x1A9, UI_INVALID_MODE | UI_INVALID_SETTINGS, 0 },
+	{ &UI::DisplayStats, &UI::StatsHandler, { 0x7C, 0x68, 0, 0 }, 0x1C7, UI_INVALID_MODE | UI_INVALID_SETTINGS, UI_REFRESH_MS },
+	{ &UI::DisplayHistory, &UI::HistoryHandler, { 0x7C, 0x191, 0, 0 }, 0x1CE, UI_INVALID_MODE | UI_INVALID_SETTINGS | UI_INVALID_RADIO, 0 },
+	{ &UI::DisplayInterlude, 0, { 0, 0, 0, 0 }, 0, UI_INVALID_MODE, UI_FRAME_MS },
+};
+
 class Effects {
 
 	EEPROM &settings;
@@ -5985,6 +8004,7 @@ class Effects {
 	SPI &spi;
 	SDD1306 &sdd1306;
 	UI &ui;
+	SX1280 &radio;
 
 	uint32_t post_clock_ms;
 	bool past_post_time;
@@ -5997,14 +8017,16 @@ public:
 			LEDs &_leds, 
 			SPI &_spi, 
 			SDD1306 &_sdd1306,
-			UI &_ui):
+			UI &_ui,
+			SX1280 &_radio):
 
 			settings(_settings),
 			random(_random),
 			leds(_leds),
 			spi(_spi),
 			sdd1306(_sdd1306),
-			ui(_ui)	{
+			ui(_ui),
+			radio(_radio) {
 		post_clock_ms = system_clock_ms + 10;
 		past_post_time = true;
 		break_on_message = false;
@@ -6014,6 +8036,8 @@ public:
 		while (1) {
 			if (past_post_time) {
 				past_post_time = false;
+				bool program_effect = ui.Mode() != 6 && ui.Mode() != 3 && ui.Mode() != 5 && ui.Mode() != 10;
+				StackMonitor::BeginEffect(program_effect ? settings.program_curr : STACK_EFFECTS);
 				if (ui.Mode() == 6) {
 					message_ring();
 				} else if ( ui.Mode() == 3 || ui.Mode() == 5 || ui.Mode() == 10) {
@@ -6105,6 +8129,7 @@ public:
 							break;
 				}
 			}
+			radio.Task();
             Chip_WWDT_Feed(LPC_WWDT);
 			__WFI();
 		}
@@ -6126,7 +8151,7 @@ private:
 			old_program_curr = settings.program_curr;
 			return true;
 		}
-		if ((ui.Mode() != old_mode) && ui.Mode() != 1 && old_mode != 1) {
+		if ((ui.Mode() != old_mode) && ui.Mode() != 1 && old_mode != 1 && ui.Mode() != 11) {
 			old_mode = ui.Mode();
 			return true;
 		}
@@ -6136,11 +8161,13 @@ private:
 	bool post_frame(uint32_t ms) {
 		post_clock_ms = system_clock_ms + ms;
 
-		if (sdd1306.DevicePresent()) {
-			ui.Display();
-		}
+		Trace::Instant(Trace::FRAME, ms);
 
 		for (;;) {
+			radio.Task();
+			if (sdd1306.DevicePresent()) {
+				ui.Update();
+			}
 			if (past_post_time) {
 				past_post_time = false;
 				return break_effect();
@@ -7363,6 +9390,7 @@ class UART {
 	#define UART_SRB_SIZE 128
 
 	#define UART_CMD_SIZE 128
+	#define UART_LINE_SIZE 80
 
 	RINGBUFF_T rxring;
 	uint8_t rxbuff[UART_RRB_SIZE];
@@ -7376,6 +9404,16 @@ class UART {
 
 	bool cmdactive;
 
+	public:
+		// Line of a multi line reply into str, false past the last one.
+		// cursor starts at 0 and is the source's to advance.
+		typedef bool (*LineSource)(uint32_t &cursor, char *str);
+
+	private:
+		LineSource dump_source;
+		uint32_t dump_cursor;
+		char dump_str[UART_LINE_SIZE];
+
 	public:
 		UART() {
 			Chip_IOCON_PinMuxSet(LPC_IOCON, (UART_TXD_PIN>>8), (UART_TXD_PIN&0xFF), IOCON_FUNC1);
@@ -7396,13 +9434,53 @@ class UART {
 			cmdactive = false;
 			cmdpos = 0;
 			cmdlen = 0;
+
+			dump_source = 0;
+			dump_cursor = 0;
+			dump_str[0] = 0;
 		}
 		
 		void RespondToCommand(const char *response) {
-			Chip_UART_SendRB(LPC_USART, &txring, response, strlen(response));
+			// Wait for the IRQ to drain the ring instead of dropping output
+			int32_t len = strlen(response);
+			while (len > 0) {
+				int32_t sent = Chip_UART_SendRB(LPC_USART, &txring, response, len);
+				response += sent;
+				len -= sent;
+				Chip_WWDT_Feed(LPC_WWDT);
+			}
 		}
 		
+		// Multi line replies go out from ContinueDump() as far as the TX
+		// ring has room, SysTick never waits for 115200 baud on them.
+		// New commands wait in the RX ring until it is done.
+		void StartDump(LineSource source) {
+			dump_source = source;
+			dump_cursor = 0;
+			dump_str[0] = 0;
+			ContinueDump();
+		}
+
+		void ContinueDump() {
+			while (dump_source) {
+				if (!dump_str[0] && !dump_source(dump_cursor, dump_str)) {
+					dump_source = 0;
+					return;
+				}
+				int32_t len = strlen(dump_str);
+				if (RingBuffer_GetFree(&txring) < len) {
+					return;
+				}
+				Chip_UART_SendRB(LPC_USART, &txring, dump_str, len);
+				dump_str[0] = 0;
+			}
+		}
+
 		bool ActiveCommand(char *cmd) {
+			ContinueDump();
+			if (dump_source) {
+				return false;
+			}
 			CheckUART();
 			if (cmdlen) {
 				cmdlen = 0;
@@ -7453,27 +9531,234 @@ private:
 		}
 };
 
+class BootProfile {
+
+	#define BOOT_PROFILE_STAGES 12
+
+	public:
+		BootProfile() {
+			stage_count = 0;
+		}
+		
+		void Mark(const char *name) {
+			if (stage_count < BOOT_PROFILE_STAGES) {
+				stage_name[stage_count] = name;
+				stage_time[stage_count] = micros();
+				stage_count++;
+			}
+		}
+
+		void Report(UART &uart) const {
+			char str[40];
+			uint32_t prev_time = 0;
+			for (uint32_t c=0; c<stage_count; c++) {
+				sprintf(str,"BOOT %-8s %7dus %7dus\r\n", stage_name[c], stage_time[c] - prev_time, stage_time[c]);
+				uart.RespondToCommand(str);
+				prev_time = stage_time[c];
+			}
+		}
+
+	private:
+		uint32_t stage_count;
+		const char *stage_name[BOOT_PROFILE_STAGES];
+		uint32_t stage_time[BOOT_PROFILE_STAGES];
+};
+
+#ifdef ENABLE_PROFILER
+class Profiler {
+
+	// 128 byte buckets over the 40KB of flash
+	#define PROFILER_BUCKET_SHIFT 7
+	#define PROFILER_BUCKETS (0xA000 >> PROFILER_BUCKET_SHIFT)
+	// ~2.05kHz at 1MHz, not a multiple of the 1ms SysTick
+	#define PROFILER_PERIOD_US 487
+
+	public:
+		Profiler() {
+			Clear();
+			Chip_TIMER_Init(LPC_TIMER16_0);
+			Chip_TIMER_Reset(LPC_TIMER16_0);
+			Chip_TIMER_PrescaleSet(LPC_TIMER16_0, (Chip_Clock_GetSystemClockRate() / 1000000) - 1);
+			Chip_TIMER_SetMatch(LPC_TIMER16_0, 0, PROFILER_PERIOD_US);
+			Chip_TIMER_ResetOnMatchEnable(LPC_TIMER16_0, 0);
+			Chip_TIMER_MatchEnableInt(LPC_TIMER16_0, 0);
+			// Highest priority so we also see time spent in other ISRs
+			NVIC_SetPriority(TIMER_16_0_IRQn, 0);
+			NVIC_ClearPendingIRQ(TIMER_16_0_IRQn);
+			NVIC_EnableIRQ(TIMER_16_0_IRQn);
+		}
+
+		void Start() {
+			Chip_TIMER_Enable(LPC_TIMER16_0);
+		}
+
+		void Stop() {
+			Chip_TIMER_Disable(LPC_TIMER16_0);
+		}
+
+		void Clear() {
+			memset(histogram, 0, sizeof(histogram));
+			total_samples = 0;
+			ram_samples = 0;
+			rom_samples = 0;
+		}
+
+		void Sample(uint32_t pc) {
+			Chip_TIMER_ClearMatch(LPC_TIMER16_0, 0);
+			total_samples++;
+			uint32_t bucket = pc >> PROFILER_BUCKET_SHIFT;
+			if (bucket < PROFILER_BUCKETS) {
+				if (histogram[bucket] != 0xFFFF) {
+					histogram[bucket]++;
+				}
+			} else if (pc >= 0x10000000 && pc < 0x10002000) {
+				ram_samples++;
+			} else {
+				// IAP and USB live in boot ROM
+				rom_samples++;
+			}
+		}
+
+		// '@PROF DUMP' a line at a time, cursor is the next bucket + 1
+		bool DumpLine(uint32_t &cursor, char *str) const {
+			if (cursor == 0) {
+				sprintf(str,"PROF %d %d %d %d\r\n", PROFILER_BUCKET_SHIFT, total_samples, ram_samples, rom_samples);
+				cursor = 1;
+				return true;
+			}
+			while (cursor <= PROFILER_BUCKETS) {
+				uint32_t c = cursor - 1;
+				cursor++;
+				if (histogram[c]) {
+					sprintf(str,"P %05x %d\r\n", c << PROFILER_BUCKET_SHIFT, histogram[c]);
+					return true;
+				}
+			}
+			if (cursor == PROFILER_BUCKETS + 1) {
+				strcpy(str,"PROF END\r\n");
+				cursor++;
+				return true;
+			}
+			return false;
+		}
+
+	private:
+		uint16_t histogram[PROFILER_BUCKETS];
+		uint32_t total_samples;
+		uint32_t ram_samples;
+		uint32_t rom_samples;
+};
+#endif  // #ifdef ENABLE_PROFILER
+
 }  // namespace {
 
 static LEDs *g_leds = 0;
 static SPI *g_spi = 0;
 static UI *g_ui = 0;
+static Buttons *g_buttons = 0;
 static Effects *g_effects = 0;
 static SX1280 *g_sx1280 = 0;
 static SDD1306 *g_sdd1306 = 0;
 static EEPROM *g_settings = 0;
 static FT25H16S *g_ft25h16s = 0;
 static UART *g_uart = 0;
+#ifdef ENABLE_PROFILER
+static Profiler *g_profiler = 0;
+#endif  // #ifdef ENABLE_PROFILER
 
 #ifdef ENABLE_USB_MSC
 static USBD_HANDLE_T g_hUsb;
 #endif  // #ifdef ENABLE_USB_MSC
 
+// Multi line UART replies, see UART::StartDump()
+
+static bool LEDsLine(uint32_t &cursor, char *str) {
+	if (cursor < 2*HALF_LEDS) {
+		rgba color = g_leds->get(cursor);
+		sprintf(str,"L %02d %02x%02x%02x\r\n", cursor, color.r(), color.g(), color.b());
+	} else if (cursor == 2*HALF_LEDS) {
+		strcpy(str,"LEDS END\r\n");
+	} else {
+		return false;
+	}
+	cursor++;
+	return true;
+}
+
+static bool CellsLine(uint32_t &cursor, char *str) {
+	if (cursor < 8*4) {
+		sprintf(str,"C %02d %04x %02x\r\n", cursor, g_sdd1306->CellChar(cursor), g_sdd1306->CellAttr(cursor));
+	} else if (cursor == 8*4) {
+		strcpy(str,"CELLS END\r\n");
+	} else {
+		return false;
+	}
+	cursor++;
+	return true;
+}
+
+static bool RadioLine(uint32_t &cursor, char *str) {
+	switch (cursor++) {
+		case 0:
+#ifdef ENABLE_PROFILER
+			sprintf(str,"RADIO SPI B/MS %d REF %d BUSY TIMEOUT %d\r\n", g_sx1280->TransportBytesPerMs(), g_sx1280->TransportBytesPerMs(true), g_sx1280->busy_timeouts);
+#else  // #ifdef ENABLE_PROFILER
+			sprintf(str,"RADIO SPI B/MS %d BUSY TIMEOUT %d\r\n", g_sx1280->TransportBytesPerMs(), g_sx1280->busy_timeouts);
+#endif  // #ifdef ENABLE_PROFILER
+			return true;
+		case 1:
+			sprintf(str,"RADIO RX %d DROP %d ERR %d TIMEOUT %d MISSED %d\r\n", g_sx1280->rx_count, g_sx1280->rx_dropped, g_sx1280->rx_errors, g_sx1280->timeouts, g_sx1280->missed_irqs);
+			return true;
+		case 2:
+			sprintf(str,"RADIO ID %04x DUP %d RELAY %d\r\n", g_sx1280->sender_id, g_sx1280->duplicates, g_sx1280->relayed);
+			return true;
+		case 3:
+			sprintf(str,"RADIO AIR US %d FULL %d TOTAL MS %d\r\n", g_sx1280->last_airtime_us, g_sx1280->AirtimeUs(24), g_sx1280->tx_airtime_ms);
+			return true;
+		case 4:
+			sprintf(str,"RADIO POWER %d NEIGHBORS %d RX LEN %d\r\n", g_sx1280->tx_power, g_sx1280->NeighborCount(), g_sx1280->RxLength());
+			return true;
+		case 5:
+			sprintf(str,"RADIO CAD BUSY %d BACKOFF %d DROP %d\r\n", g_sx1280->cad_busy, g_sx1280->backoffs, g_sx1280->tx_dropped);
+			return true;
+		case 6:
+			sprintf(str,"RADIO SNIFF MS %d ON %d/1000 LATENCY +%d MS\r\n", g_settings->radio_sniff_ms, g_sx1280->RadioOnPermille(), g_sx1280->SniffLatencyMs());
+			return true;
+	}
+	return false;
+}
+
+static bool StackLine(uint32_t &cursor, char *str) {
+	if (cursor == 0) {
+		sprintf(str,"STACK SIZE %d FREE %d MIN %d FB %d\r\n", StackMonitor::Size(), StackMonitor::Free(), StackMonitor::MinFree(), StackMonitor::fallback_count);
+	} else if (cursor <= g_settings->program_count) {
+		sprintf(str,"STACK EFX %02d %d\r\n", cursor - 1, StackMonitor::EffectPeak(cursor - 1));
+	} else {
+		return false;
+	}
+	cursor++;
+	return true;
+}
+
+static bool I2CCaptureLine(uint32_t &cursor, char *str) {
+	return i2c_bus.CaptureLine(cursor, str);
+}
+
+#ifdef ENABLE_PROFILER
+static bool ProfilerLine(uint32_t &cursor, char *str) {
+	return g_profiler->DumpLine(cursor, str);
+}
+#endif  // #ifdef ENABLE_PROFILER
+
 extern "C" {
 	
 	void SysTick_Handler(void)
 	{	
+		uint32_t trace_start = Trace::Start();
+
 		system_clock_ms++;
+
+		i2c_bus.CheckTimeout();
 		
 		g_ui->CheckInput();
 
@@ -7485,9 +9770,9 @@ extern "C" {
 			}
 		}
 		
-		if ( (system_clock_ms % (256)) == 0) {
-			g_sx1280->ProcessIrqs();
-			if (g_settings->recv_radio_message_pending && g_ui->Mode() == 0) {
+		if ( g_sx1280 ) {
+			g_sx1280->ProcessPackets();
+			if ((system_clock_ms % (256)) == 0 && g_settings->recv_radio_message_pending && g_ui->Mode() == 0) {
 				g_settings->recv_radio_message_pending = false;
 				g_ui->SetMode(system_clock_ms, 6);
 			}
@@ -7496,6 +9781,23 @@ extern "C" {
 		if ( (system_clock_ms % (1024*64)) == 0) {
 			g_settings->SaveRuntime();
 		}
+
+		if ( (system_clock_ms % 16) == 0) {
+			// Stack is about to run into the static data, go back to the
+			// first effect before the settings or warm state get hit.
+			if (!StackMonitor::tripped && !StackMonitor::GuardIntact()) {
+				StackMonitor::tripped = true;
+				StackMonitor::fallback_count++;
+				if (g_settings->program_curr != 0) {
+					g_settings->program_curr = 0;
+					g_settings->Save();
+				} else {
+					warm_state.Invalidate();
+					NVIC_SystemReset();
+				}
+			}
+			warm_state.Snapshot(g_settings->program_curr, g_ui->Mode(), g_settings->UnsavedRuntime());
+		}
 		
 		g_effects->CheckPostTime();
 		
@@ -7519,6 +9821,139 @@ extern "C" {
 					g_settings->Save();
 					g_uart->RespondToCommand("OK.\r\n");
 				}
+			} else if (strncmp(cmd,"WARM", 4) == 0) {
+				char str[32];
+				sprintf(str,"WARM RESUMES %d\r\n", warm_state.warm_resume_count);
+				g_uart->RespondToCommand(str);
+#ifdef ENABLE_PROFILER
+			} else if (strncmp(cmd,"PROF START", 10) == 0) {
+				g_profiler->Clear();
+				g_profiler->Start();
+				g_uart->RespondToCommand("OK.\r\n");
+			} else if (strncmp(cmd,"PROF STOP", 9) == 0) {
+				g_profiler->Stop();
+				g_uart->RespondToCommand("OK.\r\n");
+			} else if (strncmp(cmd,"PROF DUMP", 9) == 0) {
+				g_uart->StartDump(ProfilerLine);
+#endif  // #ifdef ENABLE_PROFILER
+			} else if (strncmp(cmd,"I2C CAPTURE", 11) == 0) {
+#ifdef ENABLE_I2C_CAPTURE
+				// Starts with a full redraw, a model of the panel needs
+				// nothing from before
+				i2c_bus.StartCapture();
+				g_sdd1306->Invalidate();
+				ui_invalid |= UI_INVALID_MODE;
+				g_uart->RespondToCommand("OK.\r\n");
+#else  // #ifdef ENABLE_I2C_CAPTURE
+				g_uart->RespondToCommand("I2C CAPTURE DISABLED\r\n");
+#endif  // #ifdef ENABLE_I2C_CAPTURE
+			} else if (strncmp(cmd,"I2C DUMP", 8) == 0) {
+				g_uart->StartDump(I2CCaptureLine);
+			} else if (strncmp(cmd,"I2C", 3) == 0) {
+				char str[48];
+				sprintf(str,"I2C TX %d ERR %d TIMEOUT %d DROP %d\r\n", i2c_bus.transactions, i2c_bus.errors, i2c_bus.timeouts, i2c_bus.dropped);
+				g_uart->RespondToCommand(str);
+			} else if (strncmp(cmd,"OLED", 4) == 0) {
+				char str[48];
+				sprintf(str,"OLED TX %d BYTES %d MAX TX %d BYTES %d\r\n", g_sdd1306->DisplayTransactions(), g_sdd1306->DisplayBytes(), g_sdd1306->DisplayTransactionsMax(), g_sdd1306->DisplayBytesMax());
+				g_uart->RespondToCommand(str);
+				sprintf(str,"OLED TRANSITION US %d MAX %d\r\n", g_sdd1306->TransitionMicros(), g_sdd1306->TransitionMicrosMax());
+				g_uart->RespondToCommand(str);
+				sprintf(str,"OLED GLYPH HIT %d MISS %d\r\n", g_sdd1306->GlyphCacheHits(), g_sdd1306->GlyphCacheMisses());
+				g_uart->RespondToCommand(str);
+#ifndef ENABLE_ASSET_STORE
+			} else if (strncmp(cmd,"ASSET WRITE", 11) == 0) {
+				if (AssetStore::Write()) {
+					g_uart->RespondToCommand("OK.\r\n");
+				} else {
+					g_uart->RespondToCommand("BAD!\r\n");
+				}
+			} else if (strncmp(cmd,"ASSET", 5) == 0) {
+				char str[32];
+				sprintf(str,"ASSET VALID %d SIZE %d\r\n", AssetStore::Verify() ? 1 : 0, ASSET_SIZE);
+				g_uart->RespondToCommand(str);
+#else  // #ifndef ENABLE_ASSET_STORE
+			} else if (strncmp(cmd,"ASSET", 5) == 0) {
+				char str[80];
+				sprintf(str,"ASSET VALID %d HIT %d MISS %d PREFETCH %d\r\n", AssetStore::valid ? 1 : 0, AssetStore::hits, AssetStore::misses, AssetStore::prefetched);
+				g_uart->RespondToCommand(str);
+#endif  // #ifndef ENABLE_ASSET_STORE
+			} else if (strncmp(cmd,"INPUT", 5) == 0) {
+				char str[64];
+				sprintf(str,"INPUT EVENTS %d DROP %d LAT US %d MAX %d\r\n", g_buttons->Events(), g_buttons->Dropped(), g_buttons->LatencyMicros(), g_buttons->LatencyMicrosMax());
+				g_uart->RespondToCommand(str);
+			} else if (strncmp(cmd,"KEY", 3) == 0) {
+				// '@KEY TS': T(op) or B(ottom), then S(hort), L(ong), H(old),
+				// D(ouble) or C(hord)
+				const char *k = cmd + 3;
+				while (*k == ' ') {
+					k++;
+				}
+				static const char gestures[] = "SLHDC";
+				static const Buttons::Gesture gesture_map[] = {
+					Buttons::SHORT, Buttons::LONG, Buttons::HOLD, Buttons::DOUBLE, Buttons::CHORD
+				};
+				const char *g = (k[0] == 'T' || k[0] == 'B') && k[1] ? strchr(gestures, k[1]) : 0;
+				if (g) {
+					g_buttons->Inject(gesture_map[g - gestures], k[0] == 'T' ? Buttons::BUTTON_TOP : Buttons::BUTTON_BOTTOM);
+					g_uart->RespondToCommand("OK.\r\n");
+				} else {
+					g_uart->RespondToCommand("BAD!\r\n");
+				}
+			} else if (strncmp(cmd,"PIN", 3) == 0) {
+				// '@PIN TD': T(op) or B(ottom), then D(own) or U(p), through the
+				// debounce like a real press. '@PIN OFF' back to the pins.
+				const char *k = cmd + 3;
+				while (*k == ' ') {
+					k++;
+				}
+				if (strncmp(k,"OFF",3) == 0) {
+					g_buttons->Release();
+					g_uart->RespondToCommand("OK.\r\n");
+				} else if ((k[0] == 'T' || k[0] == 'B') && (k[1] == 'D' || k[1] == 'U')) {
+					g_buttons->Force(k[0] == 'T' ? Buttons::BUTTON_TOP : Buttons::BUTTON_BOTTOM, k[1] == 'D');
+					g_uart->RespondToCommand("OK.\r\n");
+				} else {
+					g_uart->RespondToCommand("BAD!\r\n");
+				}
+			} else if (strncmp(cmd,"LEDS", 4) == 0) {
+				g_uart->StartDump(LEDsLine);
+			} else if (strncmp(cmd,"CELLS", 5) == 0) {
+				g_uart->StartDump(CellsLine);
+			} else if (strncmp(cmd,"RADIO", 5) == 0) {
+				g_uart->StartDump(RadioLine);
+			} else if (strncmp(cmd,"SNIFF", 5) == 0) {
+				uint32_t ms = 0;
+				for (const char *d = cmd+5; *d; d++) {
+					if (*d >= '0' && *d <= '9') {
+						ms = ms * 10 + (*d - '0');
+					}
+				}
+				if (ms > RADIO_SNIFF_MAX_MS) {
+					g_uart->RespondToCommand("SNIFF MS <= 1000.\r\n");
+				} else {
+					g_sx1280->SetSniff(ms);
+					g_settings->Save();
+					g_uart->RespondToCommand("OK.\r\n");
+				}
+			} else if (strncmp(cmd,"STACK", 5) == 0) {
+				g_uart->StartDump(StackLine);
+			} else if (strncmp(cmd,"TRACE DUMP", 10) == 0) {
+				g_uart->StartDump(Trace::DumpLine);
+			} else if (strncmp(cmd,"TRACE CLEAR", 11) == 0) {
+				Trace::Clear();
+				g_uart->RespondToCommand("OK.\r\n");
+			} else if (strncmp(cmd,"TRACE MASK", 10) == 0) {
+				uint32_t mask = 0;
+				for (const char *h = cmd+10; *h; h++) {
+					if (*h >= '0' && *h <= '9') {
+						mask = (mask << 4) | (*h - '0');
+					} else if (*h >= 'A' && *h <= 'F') {
+						mask = (mask << 4) | (*h - 'A' + 10);
+					}
+				}
+				Trace::SetMask(mask);
+				g_uart->RespondToCommand("OK.\r\n");
 			} else if (strncmp(cmd,"TEST", 4) == 0) {
 				g_sx1280->SendMessage();
 			} else if (strncmp(cmd,"RESET", 4) == 0) {
@@ -7538,14 +9973,52 @@ extern "C" {
 			g_sx1280->SendMessage();
 		}
 #endif  // #if 0
-		
+
+		Trace::Complete(Trace::SYSTICK, trace_start);
 	}
 
 	void TIMER32_0_IRQHandler(void)
 	{	
-		// nop
+		if (g_buttons) {
+			g_buttons->HandleTimerIRQ();
+		}
+	}
+
+	void I2C_IRQHandler(void)
+	{
+		i2c_bus.IRQHandler();
 	}
 
+#ifdef ENABLE_PROFILER
+	void ProfilerSample(uint32_t *frame)
+	{
+		// r0, r1, r2, r3, r12, lr, pc, xpsr
+		g_profiler->Sample(frame[6]);
+	}
+
+	// Naked so that we can find the exception frame of the interrupted
+	// context before the compiler touches the stack.
+	void TIMER16_0_IRQHandler(void) __attribute__ ((naked));
+	void TIMER16_0_IRQHandler(void)
+	{
+		__asm volatile (
+			"movs r0, #4          \n"
+			"mov  r1, lr          \n"
+			"tst  r0, r1          \n"
+			"beq  1f              \n"
+			"mrs  r0, psp         \n"
+			"b    2f              \n"
+			"1:                   \n"
+			"mrs  r0, msp         \n"
+			"2:                   \n"
+			"ldr  r1, 3f          \n"
+			"bx   r1              \n"
+			".align 2             \n"
+			"3: .word ProfilerSample \n"
+		);
+	}
+#endif  // #ifdef ENABLE_PROFILER
+
 	void UART_IRQHandler(void)
 	{
 		g_uart->IntHandler();
@@ -7553,21 +10026,24 @@ extern "C" {
 	
 	void FLEX_INT0_IRQHandler(void)
 	{
-		g_sx1280->OnDioIrq();
+		Trace::Instant(Trace::RADIO_IRQ);
+		if (g_sx1280) {
+			g_sx1280->OnDioIrq();
+		}
 		Chip_PININT_ClearIntStatus(LPC_PININT, PININTCH0);
 	}
 
 	void FLEX_INT1_IRQHandler(void)
 	{	
-		if (g_ui) {
-			g_ui->HandleINT1IRQ();
+		if (g_buttons) {
+			g_buttons->HandleEdgeIRQ(PININTCH1, Buttons::BUTTON_TOP);
 		}
 	}
 
 	void FLEX_INT2_IRQHandler(void)
 	{
-		if (g_ui) {
-			g_ui->HandleINT2IRQ();
+		if (g_buttons) {
+			g_buttons->HandleEdgeIRQ(PININTCH2, Buttons::BUTTON_BOTTOM);
 		}
 	}
 	
@@ -7836,81 +10312,114 @@ int main(void)
 {
 	SystemCoreClockUpdate();
 
-	delay(100);
-	
+	// Let the rails settle before probing I2C
+	delay(10);
+
 	SDD1306 sdd1306; g_sdd1306 = &sdd1306;
 	
 	BQ24295 bq24295;
 	
 	Setup setup(sdd1306, bq24295);
 
+	BootProfile boot;
+	boot.Mark("SETUP");
+
+	// Watchdog or soft reset with an intact snapshot: skip the splash and
+	// radio reset and pick up where we left off. After WARM_RESUME_MAX of
+	// those in quick succession do a cold boot instead.
+	uint32_t reset_status = Chip_SYSCTL_GetSystemRSTStatus();
+	Chip_SYSCTL_ClearSystemRSTStatus(reset_status);
+	bool warm = ((reset_status & (SYSCTL_RST_WDT | SYSCTL_RST_SYSRST)) != 0) &&
+				((reset_status & (SYSCTL_RST_POR | SYSCTL_RST_EXTRST | SYSCTL_RST_BOD)) == 0) &&
+				warm_state.Valid() && !warm_state.CrashLoop();
+	if (warm) {
+		system_clock_ms = warm_state.clock_ms;
+		warm_state.CountResume();
+	} else {
+		warm_state.ColdBoot();
+	}
+
 	if (bq24295.DevicePresent()) {
 		bq24295.SetBoostVoltage(4550);
 		bq24295.DisableWatchdog();
 		bq24295.DisableOTG();
 	}
+	boot.Mark("BQ24295");
 
 	EEPROM settings;
 	g_settings = &settings;
+	settings.Load();
+	if (warm) {
+		settings.RestoreRuntime(warm_state.unsaved_runtime);
+		if (warm_state.program_curr < settings.program_count) {
+			settings.program_curr = warm_state.program_curr;
+		}
+	}
+	boot.Mark("EEPROM");
 	
 	SPI spi; g_spi = &spi;
 
 	LEDs leds; g_leds = &leds;
-	
-	spi.push_null();
 
-	if (sdd1306.DevicePresent()) {
-		sdd1306.Init(); 
-		sdd1306.Clear();
-		sdd1306.DisplayBootScreen();
-		static uint8_t bounce[] = {
-			0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x1d, 0x1d, 
-			0x1c, 0x1b, 0x1a, 0x18, 0x17, 0x16, 0x14, 0x12, 
-			0x10, 0x0e, 0x0c, 0x0a, 0x08, 0x05, 0x03, 0x01, 
-			0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 
-			0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x07, 
-			0x06, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x01, 
-			0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-			0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 
-		};
-		sdd1306.SetVerticalShift(bounce[0]);
-		sdd1306.Display();
-		for (uint32_t y=0; y<64; y++) {
-			sdd1306.SetVerticalShift(bounce[y]);
-			delay(10);
-		}
-		delay(500);
-		static int8_t ease[] = {
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 
-			0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 
-			0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0e, 0x0f, 0x11, 
-			0x12, 0x14, 0x15, 0x17, 0x19, 0x1b, 0x1d, 0x1f, 
-			0x1f,
-		};
-		for (uint32_t x=0; x<=32; x++) {
-			sdd1306.SetVerticalShift(-ease[x]);
-			sdd1306.SetCenterFlip(x);
-			sdd1306.Display();
-			delay(1);
-		}
-		sdd1306.SetVerticalShift(0);
-		sdd1306.SetCenterFlip(0);
+	// Show the configured colors until the first effect frame is ready
+	for (uint32_t d = 0; d < 8; d++) {
+		leds.set_ring(d, settings.ring_color);
+	}
+	for (uint32_t d = 0; d < 4; d++) {
+		leds.set_bird(d, settings.bird_color);
 	}
-	
-	settings.Load();
 	
 	Random random(0xCAFFE);
 	
 	FT25H16S ft25h16s; g_ft25h16s = &ft25h16s;
+	AssetStore::Init(ft25h16s);
 
-	SX1280 sx1280(sdd1306, settings, ft25h16s); g_sx1280 = &sx1280;
-	sx1280.Init(false);
+	SX1280 sx1280(sdd1306, settings, ft25h16s);
 
-	if (bq24295.DevicePresent()) {
-		bq24295.SetBoostVoltage(4550);
-		bq24295.DisableWatchdog();
-		bq24295.DisableOTG();
+	Buttons buttons;
+	UI ui(settings, sdd1306, sx1280, random, ft25h16s, bq24295, buttons);
+	// For IRQ handlers only
+	g_ui = &ui;
+	ui.Init();
+	buttons.Init();
+	g_buttons = &buttons;
+
+	Effects effects(settings, random, leds, spi, sdd1306, ui, sx1280); g_effects = &effects;
+
+	UART uart; g_uart = &uart;
+
+#ifdef ENABLE_PROFILER
+	Profiler profiler; g_profiler = &profiler;
+#endif  // #ifdef ENABLE_PROFILER
+
+	// start 1ms timer, LEDs are pushed from here on
+	SysTick_Config(SystemCoreClock / 1000);
+	boot.Mark("LIGHT");
+
+	if (sdd1306.DevicePresent() && warm) {
+		sdd1306.Init(false);
+		sdd1306.Clear();
+		sdd1306.Invalidate();
+		// Interludes and the splash are not worth resuming
+		uint32_t mode = warm_state.ui_mode;
+		if (mode == 1 || mode == 6 || mode > 10) {
+			mode = 0;
+		}
+		ui.SetMode(system_clock_ms, mode);
+	} else if (sdd1306.DevicePresent()) {
+		sdd1306.Init(); 
+		sdd1306.Clear();
+		ui.SetMode(system_clock_ms, 11);
+		// Keep the splash animating while the radio resets
+		delay_yield = [] () {
+			g_ui->Update();
+		};
 	}
+	boot.Mark("SDD1306");
+	
+	sx1280.Init(false, warm);
+	g_sx1280 = &sx1280;
+	boot.Mark("SX1280");
 
 #ifdef ENABLE_USB_MSC
 	#define CMA_TIME EMFAT_ENCODE_CMA_TIME(2,4,2017, 13,0,0)
@@ -7928,19 +10437,15 @@ int main(void)
 	emfat_init(&Emfat, "emfat", emfat_entries);
 	
 	usb_init();
+	boot.Mark("USB");
 #endif  // #ifdef ENABLE_USB_MSC
 
-	UI ui(settings, sdd1306, sx1280, random, ft25h16s, bq24295);
-	// For IRQ handlers only
-	g_ui = &ui;
-	ui.Init();
-
-	// start 1ms timer
-	SysTick_Config(SystemCoreClock / 1000);
-	
-	UART uart; g_uart = &uart;
-	
 	uart.RespondToCommand("Duck Pond Pendant V2.0 by Tinic Uro (c) 2018\r\n");
+	if (warm) {
+		char str[32];
+		sprintf(str,"WARM RESUME %d\r\n", warm_state.warm_resume_count);
+		uart.RespondToCommand(str);
+	}
 	uart.RespondToCommand("SDD1306 ");
 	if (sdd1306.DevicePresent()) {
 		uart.RespondToCommand("OK.\r\n");
@@ -7980,14 +10485,25 @@ int main(void)
 	} else {
 		uart.RespondToCommand("BAD!\r\n");
 	}
+#ifdef ENABLE_ASSET_STORE
+	uart.RespondToCommand("Assets ");
+	if (AssetStore::valid) {
+		uart.RespondToCommand("OK.\r\n");
+	} else {
+		uart.RespondToCommand("BAD!\r\n");
+	}
+#endif  // #ifdef ENABLE_ASSET_STORE
 	uart.RespondToCommand("Battery Pull Down ");
 	if (!ui.BadConnection()) {
 		uart.RespondToCommand("OK.\r\n");
 	} else {
 		uart.RespondToCommand("BAD!\r\n");
 	}
-	
-	Effects effects(settings, random, leds, spi, sdd1306, ui); g_effects = &effects;
+	boot.Mark("SELFTEST");
+
+	boot.Report(uart);
+
+	delay_yield = 0;
 
 	effects.RunForever();
 	
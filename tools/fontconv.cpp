@@ -0,0 +1,346 @@
+
+// Builds duck_font.h from the GIF font sheet
+//
+// usage: fontconv font/duck_font_grafx2.gif > duck_font.h
+//
+// The sheet holds four strips of 256 glyphs, 8x8 pixels each, starting
+// at row 8. Glyph columns become bytes with the top pixel in bit 0, the
+// SSD1306 page format. Blank glyphs cost nothing, repeated glyphs are
+// stored once and every stored glyph only keeps its non-zero columns.
+// See duck_font_glyph() in main.cpp for the decoder. With ENABLE_ASSET_STORE
+// the data lives in external flash and the start of every glyph in its
+// group is kept instead.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#define GLYPH_COUNT 1024
+#define INDEX_BLOCK 128
+#define OFFSET_GROUP 16
+
+struct Image {
+	uint32_t width;
+	uint32_t height;
+	std::vector<uint8_t> pixels;	// 1 is lit
+};
+
+// Minimal GIF decoder, composites all frames onto the logical screen.
+static bool LoadGIF(const char *path, Image &image) {
+	FILE *fp = fopen(path, "rb");
+	if (!fp) {
+		return false;
+	}
+	std::vector<uint8_t> gif;
+	int ch = 0;
+	while ((ch = fgetc(fp)) != EOF) {
+		gif.push_back(uint8_t(ch));
+	}
+	fclose(fp);
+
+	size_t pos = 0;
+	auto byte = [&]() -> uint32_t { return pos < gif.size() ? gif[pos++] : 0; };
+	auto word = [&]() -> uint32_t { uint32_t l = byte(); return l | (byte() << 8); };
+
+	if (gif.size() < 13 || (memcmp(&gif[0], "GIF87a", 6) != 0 && memcmp(&gif[0], "GIF89a", 6) != 0)) {
+		return false;
+	}
+	pos = 6;
+	image.width = word();
+	image.height = word();
+	uint32_t flags = byte();
+	byte(); // background
+	byte(); // aspect
+	image.pixels.assign(image.width * image.height, 0);
+
+	uint8_t global_palette[256*3] = { 0 };
+	uint32_t global_size = 0;
+	if (flags & 0x80) {
+		global_size = 2 << (flags & 7);
+		for (uint32_t c = 0; c < global_size * 3; c++) {
+			global_palette[c] = uint8_t(byte());
+		}
+	}
+
+	int32_t transparent = -1;
+	while (pos < gif.size()) {
+		uint32_t block = byte();
+		if (block == 0x3B) {
+			break;
+		}
+		if (block == 0x21) {
+			uint32_t label = byte();
+			uint32_t len = byte();
+			if (label == 0xF9 && len >= 4) {
+				uint32_t packed = gif[pos];
+				transparent = (packed & 1) ? gif[pos + 3] : -1;
+			}
+			while (len) {
+				pos += len;
+				len = byte();
+			}
+			continue;
+		}
+		if (block != 0x2C) {
+			return false;
+		}
+
+		uint32_t left = word();
+		uint32_t top = word();
+		uint32_t w = word();
+		uint32_t h = word();
+		uint32_t iflags = byte();
+		uint8_t local_palette[256*3];
+		const uint8_t *palette = global_palette;
+		if (iflags & 0x80) {
+			uint32_t size = 2 << (iflags & 7);
+			for (uint32_t c = 0; c < size * 3; c++) {
+				local_palette[c] = uint8_t(byte());
+			}
+			palette = local_palette;
+		}
+		bool interlaced = (iflags & 0x40) != 0;
+
+		uint32_t min_code_size = byte();
+		std::vector<uint8_t> data;
+		for (uint32_t len = byte(); len; len = byte()) {
+			data.insert(data.end(), gif.begin() + pos, gif.begin() + pos + len);
+			pos += len;
+		}
+
+		// LZW
+		std::vector<uint8_t> indices;
+		std::vector<uint16_t> prefix(4096);
+		std::vector<uint8_t> suffix(4096);
+		std::vector<uint8_t> stack;
+		uint32_t clear = 1 << min_code_size;
+		uint32_t end = clear + 1;
+		uint32_t code_size = min_code_size + 1;
+		uint32_t next = end + 1;
+		int32_t old = -1;
+		uint8_t first = 0;
+		uint32_t bits = 0;
+		uint32_t acc = 0;
+		for (size_t c = 0; c < data.size(); c++) {
+			acc |= uint32_t(data[c]) << bits;
+			bits += 8;
+			while (bits >= code_size) {
+				uint32_t code = acc & ((1 << code_size) - 1);
+				acc >>= code_size;
+				bits -= code_size;
+				if (code == clear) {
+					code_size = min_code_size + 1;
+					next = end + 1;
+					old = -1;
+					continue;
+				}
+				if (code == end) {
+					c = data.size();
+					break;
+				}
+				if (old < 0) {
+					indices.push_back(uint8_t(code));
+					old = int32_t(code);
+					first = uint8_t(code);
+					continue;
+				}
+				uint32_t in = code;
+				stack.clear();
+				if (code >= next) {
+					stack.push_back(first);
+					code = uint32_t(old);
+				}
+				while (code > end) {
+					stack.push_back(suffix[code]);
+					code = prefix[code];
+				}
+				first = uint8_t(code);
+				stack.push_back(first);
+				indices.insert(indices.end(), stack.rbegin(), stack.rend());
+				if (next < 4096) {
+					prefix[next] = uint16_t(old);
+					suffix[next] = first;
+					next++;
+					if (next == (1U << code_size) && code_size < 12) {
+						code_size++;
+					}
+				}
+				old = int32_t(in);
+			}
+		}
+
+		static const uint32_t pass_start[] = { 0, 4, 2, 1 };
+		static const uint32_t pass_step[] = { 8, 8, 4, 2 };
+		uint32_t pass = 0;
+		uint32_t row = 0;
+		for (uint32_t y = 0; y < h; y++) {
+			uint32_t dy = y;
+			if (interlaced) {
+				while (row >= h) {
+					pass++;
+					row = pass_start[pass];
+				}
+				dy = row;
+				row += pass_step[pass];
+			}
+			for (uint32_t x = 0; x < w; x++) {
+				size_t i = size_t(y) * w + x;
+				if (i >= indices.size() || int32_t(indices[i]) == transparent) {
+					continue;
+				}
+				uint32_t px = left + x;
+				uint32_t py = top + dy;
+				if (px >= image.width || py >= image.height) {
+					continue;
+				}
+				const uint8_t *rgb = &palette[indices[i] * 3];
+				uint32_t luma = (rgb[0] * 299 + rgb[1] * 587 + rgb[2] * 114) / 1000;
+				image.pixels[py * image.width + px] = luma >= 128 ? 1 : 0;
+			}
+		}
+		transparent = -1;
+	}
+	return true;
+}
+
+static void PrintArray(const char *type, const char *name, const std::vector<uint32_t> &values, const char *fmt) {
+	printf("static constexpr %s %s[%u] = {", type, name, uint32_t(values.size()));
+	for (size_t c = 0; c < values.size(); c++) {
+		printf("%s", (c % 12) ? " " : "\n  ");
+		printf(fmt, values[c]);
+		printf(",");
+	}
+	printf("\n};\n\n");
+}
+
+int main(int argc, char *argv[]) {
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s duck_font_grafx2.gif > duck_font.h\n", argv[0]);
+		return 1;
+	}
+
+	Image sheet;
+	if (!LoadGIF(argv[1], sheet) || sheet.width < 2048 || sheet.height < 40) {
+		fprintf(stderr, "Could not read a 2048x40 or larger GIF from '%s'\n", argv[1]);
+		return 1;
+	}
+
+	std::vector<std::string> glyphs(GLYPH_COUNT);
+	for (uint32_t g = 0; g < GLYPH_COUNT; g++) {
+		uint32_t strip = g / 256;
+		uint32_t x0 = (g % 256) * 8;
+		uint32_t y0 = 8 + strip * 8;
+		std::string glyph(8, '\0');
+		for (uint32_t x = 0; x < 8; x++) {
+			uint8_t column = 0;
+			for (uint32_t y = 0; y < 8; y++) {
+				column |= sheet.pixels[(y0 + y) * sheet.width + x0 + x] << y;
+			}
+			glyph[x] = char(column);
+		}
+		glyphs[g] = glyph;
+	}
+
+	// Unique glyphs in order of first use, 0 in the index is blank
+	uint32_t last = 0;
+	std::map<std::string, uint32_t> ids;
+	std::vector<std::string> store;
+	std::vector<uint32_t> slot_id(GLYPH_COUNT, 0);
+	const std::string blank(8, '\0');
+	for (uint32_t g = 0; g < GLYPH_COUNT; g++) {
+		if (glyphs[g] == blank) {
+			continue;
+		}
+		auto i = ids.find(glyphs[g]);
+		if (i == ids.end()) {
+			i = ids.insert(std::make_pair(glyphs[g], uint32_t(store.size()))).first;
+			store.push_back(glyphs[g]);
+		}
+		slot_id[g] = i->second + 1;
+		last = g + 1;
+	}
+	uint32_t slots = (last + INDEX_BLOCK - 1) / INDEX_BLOCK * INDEX_BLOCK;
+
+	// Index bytes are relative to the lowest id of their block
+	std::vector<uint32_t> base;
+	std::vector<uint32_t> index;
+	for (uint32_t b = 0; b < slots; b += INDEX_BLOCK) {
+		uint32_t lo = ~0U;
+		for (uint32_t g = b; g < b + INDEX_BLOCK; g++) {
+			if (slot_id[g] && slot_id[g] < lo) {
+				lo = slot_id[g];
+			}
+		}
+		lo = (lo == ~0U) ? 1 : lo;
+		base.push_back(lo - 1);
+		for (uint32_t g = b; g < b + INDEX_BLOCK; g++) {
+			if (!slot_id[g]) {
+				index.push_back(0);
+				continue;
+			}
+			uint32_t rel = slot_id[g] - lo + 1;
+			if (rel > 255) {
+				fprintf(stderr, "Glyph %u refers too far back, use a smaller INDEX_BLOCK\n", g);
+				return 1;
+			}
+			index.push_back(rel);
+		}
+	}
+
+	// Column mask followed by the non-zero columns
+	std::vector<uint32_t> data;
+	std::vector<uint32_t> offset;
+	std::vector<uint32_t> delta;
+	for (size_t c = 0; c < store.size(); c++) {
+		if ((c % OFFSET_GROUP) == 0) {
+			offset.push_back(uint32_t(data.size()));
+		}
+		delta.push_back(uint32_t(data.size()) - offset.back());
+		uint32_t mask = 0;
+		for (uint32_t x = 0; x < 8; x++) {
+			mask |= store[c][x] ? (1 << x) : 0;
+		}
+		data.push_back(mask);
+		for (uint32_t x = 0; x < 8; x++) {
+			if (store[c][x]) {
+				data.push_back(uint8_t(store[c][x]));
+			}
+		}
+	}
+
+	// FNV-1a, ties an external copy of the data to this index
+	uint32_t checksum = 0x811C9DC5UL;
+	for (size_t c = 0; c < data.size(); c++) {
+		checksum = (checksum ^ data[c]) * 0x01000193UL;
+	}
+
+	printf("// Generated by tools/fontconv from font/duck_font_grafx2.gif, do not edit\n\n");
+	printf("#define DUCK_FONT_SLOTS %u\n", slots);
+	printf("#define DUCK_FONT_INDEX_BLOCK %u\n", INDEX_BLOCK);
+	printf("#define DUCK_FONT_OFFSET_GROUP %u\n", OFFSET_GROUP);
+	printf("#define DUCK_FONT_DATA_SIZE %u\n", uint32_t(data.size()));
+	printf("#define DUCK_FONT_CHECKSUM 0x%08xUL\n\n", checksum);
+	PrintArray("uint16_t", "duck_font_base", base, "0x%03x");
+	PrintArray("uint8_t", "duck_font_index", index, "0x%02x");
+	PrintArray("uint16_t", "duck_font_offset", offset, "0x%04x");
+	printf("#ifdef ENABLE_ASSET_STORE\n\n");
+	printf("// Glyph start within its group, the data is in external flash\n");
+	PrintArray("uint8_t", "duck_font_delta", delta, "0x%02x");
+	printf("#else  // #ifdef ENABLE_ASSET_STORE\n\n");
+	PrintArray("uint8_t", "duck_font_data", data, "0x%02x");
+	printf("#endif  // #ifdef ENABLE_ASSET_STORE\n");
+
+	uint32_t size = uint32_t(base.size() * 2 + index.size() + offset.size() * 2 + data.size());
+	fprintf(stderr, "%u glyphs, %u unique, %u blank\n", GLYPH_COUNT, uint32_t(store.size()),
+		uint32_t(std::count(slot_id.begin(), slot_id.end(), 0U)));
+	fprintf(stderr, "index %u + data %u = %u bytes, raw %u, saves %u bytes\n",
+		uint32_t(base.size() * 2 + index.size() + offset.size() * 2), uint32_t(data.size()),
+		size, GLYPH_COUNT * 8, GLYPH_COUNT * 8 - size);
+	return 0;
+}
@@ -0,0 +1,206 @@
+
+// SSD1306 model fed with the I2C traffic to the panel, writes a PBM
+// snapshot of the whole 128x32 area per frame and counts the traffic.
+//
+// usage: oled [-g gap_us] [-o prefix] capture > stats.txt
+//
+// The capture is either a Saleae Logic 2 CSV export of the I2C analyzer,
+// frames are split at bus idle times of more than gap_us (default 2000),
+// or plain text with one transaction of hex bytes per line, optionally
+// prefixed with the 7 bit address ('3c: 40 ff 00 ...'). A line starting
+// with '--' ends a frame in the text format, a '\' at the end of a line
+// continues the transaction on the next one. '@I2C CAPTURE' followed by
+// '@I2C DUMP' gets this format from the firmware itself, built with
+// ENABLE_I2C_CAPTURE, no logic analyzer needed.
+//
+// Snapshots are shown the way the pendant mounts the panel: rotated
+// 180 degrees, which Init() undoes with 0xA1 and 0xC8. The visible
+// 64x32 area is columns 32 to 95.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ssd1306.h"
+
+static const uint8_t i2caddr = 0x3C;
+
+static SSD1306 oled;
+static Counters frame_start;
+static uint32_t frames = 0;
+static const char *prefix = "frame";
+
+static void EndFrame() {
+	Counters &c = oled.count;
+	if (c.transactions == frame_start.transactions) {
+		return;
+	}
+
+	char name[256];
+	snprintf(name, sizeof(name), "%s%05u.pbm", prefix, frames);
+	if (!oled.WritePBM(name)) {
+		fprintf(stderr, "Could not write '%s'\n", name);
+	}
+
+	printf("%s tx %u bytes %u cmd %u data %u redundant %u hidden %u\n", name,
+		c.transactions - frame_start.transactions,
+		c.bytes - frame_start.bytes,
+		c.commands - frame_start.commands,
+		c.data - frame_start.data,
+		c.redundant - frame_start.redundant,
+		c.hidden - frame_start.hidden);
+
+	frame_start = c;
+	frames++;
+}
+
+static bool ParseHex(const char *str, uint32_t *v) {
+	char *end = 0;
+	unsigned long l = strtoul(str, &end, 16);
+	if (end == str) {
+		return false;
+	}
+	*v = uint32_t(l);
+	return true;
+}
+
+// Splits a CSV line in place, handles quoted fields without commas
+static uint32_t SplitCSV(char *line, char **fields, uint32_t max) {
+	uint32_t n = 0;
+	char *p = line;
+	while (n < max) {
+		if (*p == '"') {
+			p++;
+		}
+		fields[n++] = p;
+		char *e = strchr(p, ',');
+		char *q = e ? e : p + strlen(p);
+		while (q > p && (q[-1] == '"' || q[-1] == '\n' || q[-1] == '\r')) {
+			q--;
+		}
+		*q = 0;
+		if (!e) {
+			break;
+		}
+		p = e + 1;
+	}
+	return n;
+}
+
+int main(int argc, char *argv[]) {
+	uint32_t gap_us = 2000;
+	const char *path = 0;
+	for (int c = 1; c < argc; c++) {
+		if (strcmp(argv[c], "-g") == 0 && c + 1 < argc) {
+			gap_us = uint32_t(atoi(argv[++c]));
+		} else if (strcmp(argv[c], "-o") == 0 && c + 1 < argc) {
+			prefix = argv[++c];
+		} else {
+			path = argv[c];
+		}
+	}
+	if (!path) {
+		fprintf(stderr, "usage: %s [-g gap_us] [-o prefix] capture > stats.txt\n", argv[0]);
+		return 1;
+	}
+
+	FILE *fp = fopen(path, "r");
+	if (!fp) {
+		fprintf(stderr, "Could not open '%s'\n", path);
+		return 1;
+	}
+
+	memset(&frame_start, 0, sizeof(frame_start));
+
+	uint8_t buf[1024];
+	uint32_t len = 0;
+	bool csv = false;
+	bool ours = false;
+	bool more = false;
+	double last_time = -1;
+	char line[1024];
+	while (fgets(line, sizeof(line), fp)) {
+		if (strncmp(line, "name,type", 9) == 0 || strncmp(line, "\"name\",\"type\"", 13) == 0) {
+			csv = true;
+			continue;
+		}
+		if (csv) {
+			// name,type,start_time,duration,ack,address,read,data
+			char *f[8] = { 0 };
+			if (SplitCSV(line, f, 8) < 4) {
+				continue;
+			}
+			double time = atof(f[2]);
+			if (strcmp(f[1], "start") == 0) {
+				if (last_time >= 0 && (time - last_time) * 1e6 > gap_us) {
+					EndFrame();
+				}
+				len = 0;
+				ours = false;
+			} else if (strcmp(f[1], "address") == 0 && f[5]) {
+				uint32_t addr = 0;
+				ParseHex(f[5], &addr);
+				// Either the 7 bit address or the address byte
+				ours = (addr == i2caddr || addr == (i2caddr << 1)) && !(f[6] && strcmp(f[6], "true") == 0);
+			} else if (strcmp(f[1], "data") == 0 && f[7]) {
+				uint32_t v = 0;
+				if (ours && ParseHex(f[7], &v) && len < sizeof(buf)) {
+					buf[len++] = uint8_t(v);
+				}
+			} else if (strcmp(f[1], "stop") == 0) {
+				if (ours && len) {
+					oled.Transaction(buf, len);
+				}
+				len = 0;
+				ours = false;
+				last_time = time;
+			}
+			continue;
+		}
+
+		if (line[0] == '#') {
+			continue;
+		}
+		if (strncmp(line, "--", 2) == 0) {
+			EndFrame();
+			continue;
+		}
+		// A '\' at the end continues the transaction on the next line
+		bool cont = more;
+		more = strchr(line, '\\') != 0;
+		char *p = line;
+		if (!cont) {
+			len = 0;
+			ours = true;
+			char *colon = strchr(line, ':');
+			if (colon) {
+				uint32_t addr = 0;
+				ours = ParseHex(line, &addr) && addr == i2caddr;
+				p = colon + 1;
+			}
+		}
+		if (!ours) {
+			continue;
+		}
+		for (;;) {
+			char *end = 0;
+			unsigned long v = strtoul(p, &end, 16);
+			if (end == p || len >= sizeof(buf)) {
+				break;
+			}
+			buf[len++] = uint8_t(v);
+			p = end;
+		}
+		if (len && !more) {
+			oled.Transaction(buf, len);
+		}
+	}
+	fclose(fp);
+	EndFrame();
+
+	Counters &c = oled.count;
+	fprintf(stderr, "%u frames, tx %u bytes %u cmd %u data %u redundant %u hidden %u\n",
+		frames, c.transactions, c.bytes, c.commands, c.data, c.redundant, c.hidden);
+	return 0;
+}
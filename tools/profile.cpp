@@ -0,0 +1,144 @@
+
+// Resolves a '@PROF DUMP' capture against firmware.elf
+//
+// usage: profile firmware.elf capture.txt
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <elf.h>
+#include <cxxabi.h>
+
+#include <vector>
+#include <algorithm>
+
+struct Function {
+	uint32_t addr;
+	uint32_t size;
+	const char *name;
+	double samples;
+};
+
+static std::vector<Function> functions;
+
+static bool LoadSymbols(const char *path) {
+	FILE *fp = fopen(path, "rb");
+	if (!fp) {
+		return false;
+	}
+	fseek(fp, 0, SEEK_END);
+	long len = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	uint8_t *elf = (uint8_t *)malloc(len);
+	if (fread(elf, 1, len, fp) != (size_t)len) {
+		fclose(fp);
+		return false;
+	}
+	fclose(fp);
+
+	Elf32_Ehdr *ehdr = (Elf32_Ehdr *)elf;
+	if (memcmp(ehdr->e_ident, ELFMAG, SELFMAG) != 0 || ehdr->e_ident[EI_CLASS] != ELFCLASS32) {
+		return false;
+	}
+	Elf32_Shdr *shdr = (Elf32_Shdr *)(elf + ehdr->e_shoff);
+	for (int c = 0; c < ehdr->e_shnum; c++) {
+		if (shdr[c].sh_type != SHT_SYMTAB) {
+			continue;
+		}
+		Elf32_Sym *sym = (Elf32_Sym *)(elf + shdr[c].sh_offset);
+		const char *strtab = (const char *)(elf + shdr[shdr[c].sh_link].sh_offset);
+		for (uint32_t d = 0; d < shdr[c].sh_size / sizeof(Elf32_Sym); d++) {
+			if (ELF32_ST_TYPE(sym[d].st_info) != STT_FUNC || sym[d].st_size == 0) {
+				continue;
+			}
+			Function f;
+			// strip thumb bit
+			f.addr = sym[d].st_value & ~1UL;
+			f.size = sym[d].st_size;
+			f.samples = 0;
+			int status = 0;
+			const char *name = strtab + sym[d].st_name;
+			char *demangled = abi::__cxa_demangle(name, 0, 0, &status);
+			f.name = (status == 0) ? demangled : name;
+			functions.push_back(f);
+		}
+	}
+	return functions.size() != 0;
+}
+
+int main(int argc, char *argv[]) {
+	if (argc < 3) {
+		fprintf(stderr, "usage: %s firmware.elf capture.txt\n", argv[0]);
+		return 1;
+	}
+
+	if (!LoadSymbols(argv[1])) {
+		fprintf(stderr, "Could not read symbols from '%s'\n", argv[1]);
+		return 1;
+	}
+
+	FILE *fp = fopen(argv[2], "r");
+	if (!fp) {
+		fprintf(stderr, "Could not open '%s'\n", argv[2]);
+		return 1;
+	}
+
+	uint32_t shift = 0;
+	uint32_t total = 0;
+	uint32_t ram = 0;
+	uint32_t rom = 0;
+	double unknown = 0;
+	char line[256];
+	while (fgets(line, sizeof(line), fp)) {
+		const char *str = strstr(line, "PROF ");
+		if (str && strncmp(str, "PROF END", 8) != 0) {
+			sscanf(str, "PROF %u %u %u %u", &shift, &total, &ram, &rom);
+			continue;
+		}
+		uint32_t addr = 0;
+		uint32_t count = 0;
+		if (sscanf(line, "P %x %u", &addr, &count) != 2 || !shift) {
+			continue;
+		}
+		// Distribute the bucket over the functions it overlaps
+		uint32_t bucket_start = addr;
+		uint32_t bucket_end = addr + (1UL << shift);
+		double covered = 0;
+		for (size_t c = 0; c < functions.size(); c++) {
+			uint32_t s = std::max(bucket_start, functions[c].addr);
+			uint32_t e = std::min(bucket_end, functions[c].addr + functions[c].size);
+			if (s < e) {
+				double share = double(e - s) / double(bucket_end - bucket_start);
+				functions[c].samples += count * share;
+				covered += share;
+			}
+		}
+		if (covered < 1.0) {
+			unknown += count * (1.0 - covered);
+		}
+	}
+	fclose(fp);
+
+	if (!total) {
+		fprintf(stderr, "No samples in '%s'\n", argv[2]);
+		return 1;
+	}
+
+	std::sort(functions.begin(), functions.end(), [](const Function &a, const Function &b) {
+		return a.samples > b.samples;
+	});
+
+	printf("%u samples, %u in RAM, %u in ROM\n\n", total, ram, rom);
+	printf("%8s %7s  %s\n", "samples", "%", "function");
+	for (size_t c = 0; c < functions.size(); c++) {
+		if (functions[c].samples < 0.5) {
+			break;
+		}
+		printf("%8.1f %6.2f%%  %s\n", functions[c].samples, 100.0 * functions[c].samples / total, functions[c].name);
+	}
+	if (unknown >= 0.5) {
+		printf("%8.1f %6.2f%%  %s\n", unknown, 100.0 * unknown / total, "<unknown>");
+	}
+	return 0;
+}
@@ -0,0 +1,467 @@
+
+// Replays a script of button gestures against a pendant on the serial
+// port, captures the LEDs and the panel after each one and measures the
+// latencies below from the trace. Needs ENABLE_TRACE and
+// ENABLE_I2C_CAPTURE.
+//
+// usage: replay [-s settle_ms] [-o prefix] [-l led_ms] [-d oled_ms]
+//               [-i input_ms] /dev/ttyUSB0 script.txt > latency.txt
+//
+// The script has one gesture per line, the time in ms since the start
+// of the replay and the button (T)op or (B)ottom followed by (S)hort,
+// (L)ong, (H)old, (D)ouble or (C)hord, e.g. '1500 TS'. Lines starting
+// with '#' are comments.
+//
+// Each gesture is played as pin levels with '@PIN', which the button
+// sampler reads instead of the pins, so debounce and gesture detection
+// run as for a real press. Contact bounce is not simulated and the
+// timing of the levels is only as good as the serial round trip. After
+// settle_ms (default 500) the trace is read back and:
+//
+//  input  time from the pin change which completed the gesture until
+//         the UI acted on it, debounce included
+//  led    time until the next LED frame after that was pushed
+//  oled   time until the next I2C transfer to the panel completed
+//
+// The panel is done when its last byte left the I2C controller, not when
+// it lit up, the pixel response of the OLED is not included.
+//
+// prefixNNN.ppm is the LED state (front ring on top) and prefixNNN.pbm
+// the panel, from the firmware's '@I2C CAPTURE' of the panel writes fed
+// through the model in tools/ssd1306.h, the same as tools/oled. Exits
+// with 1 if any latency is over its limit, a gesture is missing its
+// input, LED or panel record or the capture overflowed.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <sys/select.h>
+#include <sys/time.h>
+
+#include "ssd1306.h"
+
+// Keep in sync with Trace::Event in main.cpp
+static const uint32_t event_frame = 1;
+static const uint32_t event_i2c = 3;
+static const uint32_t event_input = 12;
+
+static const uint8_t i2caddr = 0x3C;
+
+static int fd = -1;
+
+static uint64_t Now() {
+	struct timeval tv;
+	gettimeofday(&tv, 0);
+	return uint64_t(tv.tv_sec) * 1000 + tv.tv_usec / 1000;
+}
+
+static bool OpenSerial(const char *path) {
+	fd = open(path, O_RDWR | O_NOCTTY);
+	if (fd < 0) {
+		return false;
+	}
+	struct termios tio;
+	if (tcgetattr(fd, &tio) != 0) {
+		return false;
+	}
+	cfmakeraw(&tio);
+	cfsetispeed(&tio, B115200);
+	cfsetospeed(&tio, B115200);
+	tio.c_cflag |= CLOCAL | CREAD;
+	tio.c_cc[VMIN] = 0;
+	tio.c_cc[VTIME] = 0;
+	if (tcsetattr(fd, TCSANOW, &tio) != 0) {
+		return false;
+	}
+	tcflush(fd, TCIOFLUSH);
+	return true;
+}
+
+// One line without the line end, false on timeout
+static bool ReadLine(char *line, uint32_t max, uint32_t timeout_ms) {
+	uint32_t len = 0;
+	uint64_t end = Now() + timeout_ms;
+	for (;;) {
+		uint64_t now = Now();
+		if (now >= end) {
+			return false;
+		}
+		fd_set set;
+		FD_ZERO(&set);
+		FD_SET(fd, &set);
+		struct timeval tv;
+		tv.tv_sec = 0;
+		tv.tv_usec = (end - now) * 1000;
+		if (select(fd + 1, &set, 0, 0, &tv) <= 0) {
+			continue;
+		}
+		char ch = 0;
+		if (read(fd, &ch, 1) != 1) {
+			continue;
+		}
+		if (ch == '\r' || ch == '\n') {
+			if (len) {
+				line[len] = 0;
+				return true;
+			}
+			continue;
+		}
+		if (len < max - 1) {
+			line[len++] = ch;
+		}
+	}
+}
+
+static void Send(const char *cmd) {
+	char str[64];
+	int len = snprintf(str, sizeof(str), "@%s\r", cmd);
+	if (write(fd, str, len) != len) {
+		fprintf(stderr, "Could not write '%s'\n", cmd);
+	}
+}
+
+// Sends a command and reads lines up to and including the one starting
+// with last, the firmware echoes the command itself first
+static bool Command(const char *cmd, const char *last, void (*parse)(const char *line)) {
+	Send(cmd);
+	char line[256];
+	while (ReadLine(line, sizeof(line), 2000)) {
+		if (line[0] == '@') {
+			continue;
+		}
+		if (strncmp(line, "TRACE DISABLED", 14) == 0) {
+			fprintf(stderr, "Firmware was built without ENABLE_TRACE\n");
+			exit(1);
+		}
+		if (strncmp(line, "I2C CAPTURE DISABLED", 20) == 0) {
+			fprintf(stderr, "Firmware was built without ENABLE_I2C_CAPTURE\n");
+			exit(1);
+		}
+		if (parse) {
+			parse(line);
+		}
+		if (strncmp(line, last, strlen(last)) == 0) {
+			return true;
+		}
+	}
+	fprintf(stderr, "No answer to '%s'\n", cmd);
+	return false;
+}
+
+struct Latency {
+	uint32_t record;	// input record of the gesture, from 1
+	uint32_t inputs;
+	bool valid;
+	uint32_t input_time;
+	uint32_t input_us;
+	uint32_t led_us;
+	uint32_t oled_us;
+	bool led_seen;
+	bool oled_seen;
+	uint32_t i2c_addr;
+};
+
+static Latency latency;
+
+static void ParseTrace(const char *line) {
+	uint32_t time = 0;
+	uint32_t event = 0;
+	char phase = 0;
+	uint32_t arg = 0;
+	if (sscanf(line, "T %x %x %c %x", &time, &event, &phase, &arg) != 4) {
+		return;
+	}
+	if (event == event_input && phase == 'X' && !latency.valid) {
+		if (++latency.inputs < latency.record) {
+			return;
+		}
+		latency.valid = true;
+		latency.input_time = time;
+		latency.input_us = arg;
+		return;
+	}
+	if (!latency.valid) {
+		return;
+	}
+	// Unsigned difference, the us clock wraps after ~71 minutes
+	uint32_t since = time - latency.input_time;
+	if (since < latency.input_us || since > 0x80000000UL) {
+		return;
+	}
+	if (event == event_frame && phase == 'i' && !latency.led_seen) {
+		latency.led_seen = true;
+		latency.led_us = since;
+	} else if (event == event_i2c && phase == 'B') {
+		latency.i2c_addr = arg;
+	} else if (event == event_i2c && phase == 'E' && latency.i2c_addr == i2caddr && !latency.oled_seen) {
+		latency.oled_seen = true;
+		latency.oled_us = since;
+	}
+}
+
+static uint8_t leds[24][3];
+
+static void ParseLEDs(const char *line) {
+	uint32_t index = 0;
+	uint32_t color = 0;
+	if (sscanf(line, "L %u %x", &index, &color) == 2 && index < 24) {
+		leds[index][0] = color >> 16;
+		leds[index][1] = color >> 8;
+		leds[index][2] = color;
+	}
+}
+
+static SSD1306 oled;
+static bool i2c_full;
+static bool i2c_more;
+static bool i2c_ours;
+static uint8_t i2c_buf[256];
+static uint32_t i2c_len;
+
+// Same as the startup_sequence of SDD1306::Init() in main.cpp, the
+// capture starts with a full redraw but not with the panel setup
+static const uint8_t startup_sequence[] = {
+	0x00, 0xAE, 0xD5, 0x80, 0xA8, 0x1F, 0xD3, 0x00, 0x8D, 0x14, 0x40,
+	0x20, 0x00, 0xA6, 0xA4, 0xA1, 0xC8, 0xDA, 0x12, 0x81, 0x00, 0xD9,
+	0xF1, 0xDB, 0x40, 0xAF
+};
+
+// '@I2C DUMP' lines, the text format of tools/oled
+static void ParseI2C(const char *line) {
+	if (line[0] == '#') {
+		if (strstr(line, "FULL")) {
+			i2c_full = true;
+		}
+		return;
+	}
+	if (strncmp(line, "--", 2) == 0) {
+		return;
+	}
+	bool cont = i2c_more;
+	i2c_more = strchr(line, '\\') != 0;
+	const char *p = line;
+	if (!cont) {
+		i2c_len = 0;
+		const char *colon = strchr(line, ':');
+		i2c_ours = colon && strtoul(line, 0, 16) == i2caddr;
+		p = colon ? colon + 1 : line;
+	}
+	if (!i2c_ours) {
+		return;
+	}
+	for (;;) {
+		char *end = 0;
+		unsigned long v = strtoul(p, &end, 16);
+		if (end == p || i2c_len >= sizeof(i2c_buf)) {
+			break;
+		}
+		i2c_buf[i2c_len++] = uint8_t(v);
+		p = end;
+	}
+	if (i2c_len && !i2c_more) {
+		oled.Transaction(i2c_buf, i2c_len);
+	}
+}
+
+static void WriteImages(const char *prefix, uint32_t step) {
+	char name[256];
+	snprintf(name, sizeof(name), "%s%03u.ppm", prefix, step);
+	FILE *fp = fopen(name, "wb");
+	if (fp) {
+		fprintf(fp, "P6\n12 2\n255\n");
+		fwrite(leds, 1, sizeof(leds), fp);
+		fclose(fp);
+	} else {
+		fprintf(stderr, "Could not write '%s'\n", name);
+	}
+
+	snprintf(name, sizeof(name), "%s%03u.pbm", prefix, step);
+	if (!oled.WritePBM(name)) {
+		fprintf(stderr, "Could not write '%s'\n", name);
+	}
+}
+
+// Pin levels of a gesture: D/U top or bottom button down/up, d/u the
+// other one, a number waits that many ms and '|' clears the trace. The
+// UI acts on every event, so after the clear the gesture is the input
+// record at 'record'. Keep in sync with Buttons in main.cpp.
+struct Gesture {
+	char key;
+	const char *levels;
+	uint32_t record;
+};
+
+static const Gesture gestures[] = {
+	{ 'S', "D 80 | U", 2 },						// RELEASE, SHORT
+	{ 'L', "D 650 | 350 U", 1 },				// LONG at 750
+	{ 'H', "D 4900 | 300 U", 1 },				// HOLD at 5000
+	{ 'D', "D 60 U 120 D 60 | U", 3 },			// RELEASE, SHORT, DOUBLE
+	{ 'C', "D 40 | d 100 U u", 2 },				// PRESS, CHORD
+};
+
+static bool Play(const Gesture &g, char button) {
+	char other = button == 'T' ? 'B' : 'T';
+	for (const char *p = g.levels; *p; p++) {
+		char cmd[16];
+		if (*p >= '0' && *p <= '9') {
+			char *end = 0;
+			usleep(uint32_t(strtoul(p, &end, 10)) * 1000);
+			p = end - 1;
+			continue;
+		} else if (*p == '|') {
+			if (!Command("TRACE CLEAR", "OK.", 0)) {
+				return false;
+			}
+			continue;
+		} else if (*p == 'D' || *p == 'U') {
+			snprintf(cmd, sizeof(cmd), "PIN %c%c", button, *p);
+		} else if (*p == 'd' || *p == 'u') {
+			snprintf(cmd, sizeof(cmd), "PIN %c%c", other, *p - 'a' + 'A');
+		} else {
+			continue;
+		}
+		if (!Command(cmd, "OK.", 0)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+int main(int argc, char *argv[]) {
+	uint32_t settle_ms = 500;
+	uint32_t led_limit = 0;
+	uint32_t oled_limit = 0;
+	uint32_t input_limit = 0;
+	const char *prefix = "replay";
+	const char *tty = 0;
+	const char *path = 0;
+	for (int c = 1; c < argc; c++) {
+		if (strcmp(argv[c], "-s") == 0 && c + 1 < argc) {
+			settle_ms = uint32_t(atoi(argv[++c]));
+		} else if (strcmp(argv[c], "-o") == 0 && c + 1 < argc) {
+			prefix = argv[++c];
+		} else if (strcmp(argv[c], "-l") == 0 && c + 1 < argc) {
+			led_limit = uint32_t(atoi(argv[++c]));
+		} else if (strcmp(argv[c], "-d") == 0 && c + 1 < argc) {
+			oled_limit = uint32_t(atoi(argv[++c]));
+		} else if (strcmp(argv[c], "-i") == 0 && c + 1 < argc) {
+			input_limit = uint32_t(atoi(argv[++c]));
+		} else if (!tty) {
+			tty = argv[c];
+		} else {
+			path = argv[c];
+		}
+	}
+	if (!tty || !path) {
+		fprintf(stderr, "usage: %s [-s settle_ms] [-o prefix] [-l led_ms] [-d oled_ms] [-i input_ms] tty script.txt > latency.txt\n", argv[0]);
+		return 1;
+	}
+
+	FILE *fp = fopen(path, "r");
+	if (!fp) {
+		fprintf(stderr, "Could not open '%s'\n", path);
+		return 1;
+	}
+	if (!OpenSerial(tty)) {
+		fprintf(stderr, "Could not open '%s'\n", tty);
+		return 1;
+	}
+
+	// Only what we measure, so the buffer does not overflow while settling
+	char mask[32];
+	snprintf(mask, sizeof(mask), "TRACE MASK %X", (1U << event_frame) | (1U << event_i2c) | (1U << event_input));
+	if (!Command(mask, "OK.", 0)) {
+		return 1;
+	}
+
+	// Panel setup for the model, then everything from a full redraw on
+	oled.Transaction(startup_sequence, sizeof(startup_sequence));
+	if (!Command("I2C CAPTURE", "OK.", 0)) {
+		return 1;
+	}
+
+	printf("# gestures through debounce, panel done when its last byte was sent\n");
+
+	uint32_t steps = 0;
+	uint32_t missing = 0;
+	uint32_t over = 0;
+	Latency max;
+	memset(&max, 0, sizeof(max));
+	uint64_t start = Now();
+	char line[256];
+	while (fgets(line, sizeof(line), fp)) {
+		uint32_t time_ms = 0;
+		char key[3] = { 0 };
+		if (line[0] == '#' || sscanf(line, "%u %2s", &time_ms, key) != 2) {
+			continue;
+		}
+		const Gesture *g = 0;
+		for (uint32_t c = 0; c < sizeof(gestures) / sizeof(gestures[0]); c++) {
+			if (gestures[c].key == key[1]) {
+				g = &gestures[c];
+			}
+		}
+		if (!g || (key[0] != 'T' && key[0] != 'B')) {
+			fprintf(stderr, "%u: '%s' is not a gesture\n", time_ms, key);
+			return 1;
+		}
+		while (Now() < start + time_ms) {
+			usleep(1000);
+		}
+
+		memset(&latency, 0, sizeof(latency));
+		latency.record = g->record;
+		if (!Play(*g, key[0])) {
+			fprintf(stderr, "%u: '%s' was not accepted\n", time_ms, key);
+			Command("PIN OFF", "OK.", 0);
+			return 1;
+		}
+		usleep(settle_ms * 1000);
+		Command("TRACE DUMP", "TRACE END", ParseTrace);
+		Command("LEDS", "LEDS END", ParseLEDs);
+		i2c_more = false;
+		Command("I2C DUMP", "# I2C END", ParseI2C);
+		WriteImages(prefix, steps);
+
+		if (i2c_full) {
+			// The model missed writes, start over from a full redraw
+			printf("%03u %8u %s i2c capture full\n", steps, time_ms, key);
+			missing++;
+			i2c_full = false;
+			Command("I2C CAPTURE", "OK.", 0);
+		} else if (!latency.valid) {
+			printf("%03u %8u %s no input record\n", steps, time_ms, key);
+			missing++;
+		} else if (!latency.led_seen || !latency.oled_seen) {
+			// Nothing reached the LEDs or the panel, a stuck UI would
+			// otherwise pass every limit with 0
+			printf("%03u %8u %s input %6u no%s%s record\n", steps, time_ms, key, latency.input_us,
+				latency.led_seen ? "" : " led", latency.oled_seen ? "" : " oled");
+			missing++;
+		} else {
+			bool late = (input_limit && latency.input_us > input_limit * 1000) ||
+						(led_limit && latency.led_us > led_limit * 1000) ||
+						(oled_limit && latency.oled_us > oled_limit * 1000);
+			printf("%03u %8u %s input %6u led %6u oled %6u us%s\n", steps, time_ms, key,
+				latency.input_us, latency.led_us, latency.oled_us, late ? " LATE" : "");
+			over += late ? 1 : 0;
+			if (latency.input_us > max.input_us) max.input_us = latency.input_us;
+			if (latency.led_us > max.led_us) max.led_us = latency.led_us;
+			if (latency.oled_us > max.oled_us) max.oled_us = latency.oled_us;
+		}
+		steps++;
+	}
+	fclose(fp);
+
+	Command("PIN OFF", "OK.", 0);
+	Command("TRACE MASK FFFFFFFA", "OK.", 0);
+	close(fd);
+
+	fprintf(stderr, "%u gestures, max input %u led %u oled %u us (panel done when sent), %u late, %u without record\n",
+		steps, max.input_us, max.led_us, max.oled_us, over, missing);
+	return (over || missing) ? 1 : 0;
+}
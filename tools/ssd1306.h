@@ -0,0 +1,216 @@
+// SSD1306 model for the host tools, fed with the I2C transactions to the
+// panel. Shared by tools/oled and tools/replay.
+
+#ifndef SSD1306_MODEL_H
+#define SSD1306_MODEL_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+struct Counters {
+	uint32_t transactions;
+	uint32_t bytes;
+	uint32_t commands;
+	uint32_t data;
+	uint32_t redundant;	// data bytes which did not change GDDRAM
+	uint32_t hidden;	// data bytes outside of the visible 64x32 area
+};
+
+class SSD1306 {
+
+public:
+
+	SSD1306() {
+		memset(ram, 0, sizeof(ram));
+		memset(args, 0, sizeof(args));
+		addressing = 2;
+		col_start = 0;
+		col_end = 127;
+		page_start = 0;
+		page_end = 7;
+		col = 0;
+		page = 0;
+		start_line = 0;
+		offset = 0;
+		mux = 64;
+		seg_remap = false;
+		com_remap = false;
+		inverse = false;
+		on = false;
+		cmd = 0;
+		args_needed = 0;
+		args_count = 0;
+	}
+
+	void Transaction(const uint8_t *buf, uint32_t len) {
+		count.transactions++;
+		count.bytes += len;
+		// Control byte: D/C selects data, Co means a single byte follows
+		// and then another control byte.
+		uint32_t c = 0;
+		while (c < len) {
+			uint8_t control = buf[c++];
+			bool is_data = (control & 0x40) != 0;
+			bool single = (control & 0x80) != 0;
+			uint32_t end = single ? ((c + 1 < len) ? c + 1 : len) : len;
+			for (; c < end; c++) {
+				if (is_data) {
+					Data(buf[c]);
+				} else {
+					Command(buf[c]);
+				}
+			}
+		}
+	}
+
+	// Panel orientation as mounted, 128 x mux pixels
+	bool Pixel(uint32_t x, uint32_t y) const {
+		uint32_t seg = 127 - x;
+		uint32_t com = (mux - 1) - y;
+		uint32_t c = seg_remap ? (127 - seg) : seg;
+		uint32_t r = com_remap ? (mux - 1 - com) : com;
+		uint32_t row = (r + start_line + offset) & 63;
+		bool v = (ram[row >> 3][c] >> (row & 7)) & 1;
+		return on && (v != inverse);
+	}
+
+	uint32_t Height() const { return mux; }
+
+	// 128 x Height() PBM of the panel as mounted
+	bool WritePBM(const char *name) const {
+		FILE *fp = fopen(name, "wb");
+		if (!fp) {
+			return false;
+		}
+		fprintf(fp, "P4\n128 %u\n", Height());
+		for (uint32_t y = 0; y < Height(); y++) {
+			for (uint32_t x = 0; x < 128; x += 8) {
+				uint8_t b = 0;
+				for (uint32_t d = 0; d < 8; d++) {
+					b |= Pixel(x + d, y) ? (0x80 >> d) : 0;
+				}
+				fputc(b, fp);
+			}
+		}
+		fclose(fp);
+		return true;
+	}
+
+	Counters count;
+
+private:
+
+	void Command(uint8_t v) {
+		count.commands++;
+		if (args_needed) {
+			args[args_count++] = v;
+			if (args_count == args_needed) {
+				args_needed = 0;
+				Execute();
+			}
+			return;
+		}
+		cmd = v;
+		args_count = 0;
+		switch (v) {
+			case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+			case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+				args_needed = 1;
+				break;
+			case 0x21: case 0x22: case 0xA3:
+				args_needed = 2;
+				break;
+			case 0x29: case 0x2A:
+				args_needed = 5;
+				break;
+			case 0x26: case 0x27:
+				args_needed = 6;
+				break;
+			default:
+				Execute();
+				break;
+		}
+	}
+
+	void Execute() {
+		if (cmd < 0x10) {
+			col = (col & 0xF0) | cmd;
+		} else if (cmd < 0x20) {
+			col = (col & 0x0F) | ((cmd & 0x07) << 4);
+		} else if (cmd >= 0x40 && cmd < 0x80) {
+			start_line = cmd & 0x3F;
+		} else if (cmd >= 0xB0 && cmd < 0xB8) {
+			page = cmd & 0x07;
+		} else switch (cmd) {
+			case 0x20: addressing = args[0] & 0x03; break;
+			case 0x21: col_start = args[0] & 0x7F; col_end = args[1] & 0x7F; col = col_start; break;
+			case 0x22: page_start = args[0] & 0x07; page_end = args[1] & 0x07; page = page_start; break;
+			case 0xA8: mux = (args[0] & 0x3F) + 1; break;
+			case 0xD3: offset = args[0] & 0x3F; break;
+			case 0xA0: seg_remap = false; break;
+			case 0xA1: seg_remap = true; break;
+			case 0xC0: com_remap = false; break;
+			case 0xC8: com_remap = true; break;
+			case 0xA6: inverse = false; break;
+			case 0xA7: inverse = true; break;
+			case 0xAE: on = false; break;
+			case 0xAF: on = true; break;
+			case 0x2F: fprintf(stderr, "hardware scroll is not modelled\n"); break;
+		}
+	}
+
+	void Data(uint8_t v) {
+		count.data++;
+		if (ram[page][col] == v) {
+			count.redundant++;
+		}
+		if (col < 32 || col > 95 || page > 3) {
+			count.hidden++;
+		}
+		ram[page][col] = v;
+		switch (addressing) {
+			case 0: // horizontal
+				if (col >= col_end) {
+					col = col_start;
+					page = (page >= page_end) ? page_start : page + 1;
+				} else {
+					col++;
+				}
+				break;
+			case 1: // vertical
+				if (page >= page_end) {
+					page = page_start;
+					col = (col >= col_end) ? col_start : col + 1;
+				} else {
+					page++;
+				}
+				break;
+			default: // page, no wrap to the next page
+				col = (col + 1) & 0x7F;
+				break;
+		}
+	}
+
+	uint8_t ram[8][128];
+	uint32_t addressing;
+	uint32_t col_start;
+	uint32_t col_end;
+	uint32_t page_start;
+	uint32_t page_end;
+	uint32_t col;
+	uint32_t page;
+	uint32_t start_line;
+	uint32_t offset;
+	uint32_t mux;
+	bool seg_remap;
+	bool com_remap;
+	bool inverse;
+	bool on;
+	uint8_t cmd;
+	uint8_t args[6];
+	uint32_t args_needed;
+	uint32_t args_count;
+};
+
+#endif  // #ifndef SSD1306_MODEL_H
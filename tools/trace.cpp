@@ -0,0 +1,94 @@
+
+// Converts a '@TRACE DUMP' capture into Chrome trace JSON, load the
+// result in chrome://tracing or ui.perfetto.dev
+//
+// usage: trace capture.txt > trace.json
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+// Keep in sync with Trace::Event in main.cpp
+static const char *event_names[] = {
+	"SysTick",
+	"Frame",
+	"LED push",
+	"I2C",
+	"Display",
+	"Radio IRQ",
+	"Radio process",
+	"rxDone",
+	"RecordMessage",
+	"EEPROM save",
+	"Flash write",
+	"Flash erase",
+	"Input",
+};
+
+int main(int argc, char *argv[]) {
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s capture.txt > trace.json\n", argv[0]);
+		return 1;
+	}
+
+	FILE *fp = fopen(argv[1], "r");
+	if (!fp) {
+		fprintf(stderr, "Could not open '%s'\n", argv[1]);
+		return 1;
+	}
+
+	printf("{\"traceEvents\":[\n");
+
+	uint32_t records = 0;
+	uint32_t dropped = 0;
+	uint32_t prev_time = 0;
+	uint64_t base_time = 0;
+	bool first = true;
+	char line[256];
+	while (fgets(line, sizeof(line), fp)) {
+		if (sscanf(line, "TRACE %u %u", &records, &dropped) == 2) {
+			continue;
+		}
+		uint32_t time = 0;
+		uint32_t event = 0;
+		char phase = 0;
+		uint32_t arg = 0;
+		if (sscanf(line, "T %x %x %c %x", &time, &event, &phase, &arg) != 4) {
+			continue;
+		}
+
+		// The us clock wraps after ~71 minutes
+		if (!first && time < prev_time && (prev_time - time) > 0x80000000UL) {
+			base_time += 0x100000000ULL;
+		}
+		prev_time = time;
+
+		char name[32];
+		if (event < sizeof(event_names) / sizeof(event_names[0])) {
+			snprintf(name, sizeof(name), "%s", event_names[event]);
+		} else {
+			snprintf(name, sizeof(name), "Event %u", event);
+		}
+
+		printf("%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu,\"pid\":0,\"tid\":0",
+			first ? "" : ",\n", name, phase, (unsigned long long)(base_time + time));
+		if (phase == 'X') {
+			printf(",\"dur\":%u", arg);
+		} else {
+			if (phase == 'i') {
+				printf(",\"s\":\"t\"");
+			}
+			printf(",\"args\":{\"arg\":%u}", arg);
+		}
+		printf("}");
+		first = false;
+	}
+	fclose(fp);
+
+	printf("\n]}\n");
+
+	if (dropped) {
+		fprintf(stderr, "%u records, %u older records were overwritten\n", records, dropped);
+	}
+	return 0;
+}